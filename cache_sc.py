@@ -74,7 +74,7 @@ class L2Cache(Cache):
     # replacement_policy = LRURP()
     # tags = BaseSetAssoc()
     replacement_policy = SCRP()
-    tags = SCSetAssoc()
+    tags = BaseSetAssoc()
     replacement_policy.num_sc_ways = 4
 
 class IOCache(Cache):
@@ -122,7 +122,14 @@ def config_cache(options, system):
                                    **_get_cache_opts('l2', options))
 
         system.tol2bus = L2XBar(clk_domain = system.cpu_clk_domain)
-        system.l2.cpu_side = system.tol2bus.mem_side_ports
+        if options.l2_trace_file:
+            system.l2_monitor = CommMonitor()
+            system.l2_monitor.trace = MemTraceProbe(
+                trace_file = options.l2_trace_file)
+            system.tol2bus.mem_side_ports = system.l2_monitor.cpu_side_port
+            system.l2_monitor.mem_side_port = system.l2.cpu_side
+        else:
+            system.l2.cpu_side = system.tol2bus.mem_side_ports
         system.l2.mem_side = system.membus.cpu_side_ports
 
     if options.memchecker:
@@ -76,7 +76,7 @@ class L2Cache(Cache):
     # replacement_policy = LRURP()
     # tags = BaseSetAssoc()
     replacement_policy = SCRP()
-    tags = SCSetAssoc()
+    tags = BaseSetAssoc()
     replacement_policy.num_sc_ways = 8
 
 class IOCache(Cache):
@@ -153,6 +153,10 @@ def addNoISAOptions(parser):
     parser.add_argument("--l2_assoc", type=int, default=8)
     parser.add_argument("--l3_assoc", type=int, default=16)
     parser.add_argument("--cacheline_size", type=int, default=64)
+    parser.add_argument("--l2-trace-file", type=str, default="",
+                        help="Record the requests received by the L2 into "
+                        "a packet trace, e.g. to replay them with "
+                        "configs/example/cache_replay.py")
 
     # Enable Ruby
     parser.add_argument("--ruby", action="store_true")
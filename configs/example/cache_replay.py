@@ -0,0 +1,102 @@
+# Copyright (c) 2026 The gem5 Shepherd Cache authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Replay a packet trace of the requests received by an L2 cache into a
+# standalone L2, without simulating the CPUs that produced them. This is
+# meant for quick replacement policy sweeps. Record the trace with the
+# --l2-trace-file option of se.py or fs.py, then e.g.:
+#   gem5.fast configs/example/cache_replay.py l2.trc.gz --l2-rp=LRURP
+
+import argparse
+
+import m5
+from m5.objects import *
+from m5.util import addToPath
+
+addToPath('../')
+
+from common import ObjectList
+from common.Caches import L2Cache
+
+parser = argparse.ArgumentParser(
+    formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+
+parser.add_argument("trace", help="Packet trace of the L2 requests")
+parser.add_argument("--l2_size", type=str, default="512kB")
+parser.add_argument("--l2_assoc", type=int, default=16)
+parser.add_argument("--cacheline_size", type=int, default=64)
+parser.add_argument("--l2-rp", type=str, default=None,
+                    choices=ObjectList.rp_list.get_names(),
+                    help="Replacement policy of the L2, instead of the "
+                    "one of common.Caches.L2Cache")
+parser.add_argument("--num-sc-ways", type=int, default=None,
+                    help="Number of Shepherd Cache ways, if the "
+                    "replacement policy is a Shepherd Cache")
+parser.add_argument("--mem-size", type=str, default="8GB",
+                    help="Size of the address range of the trace")
+parser.add_argument("-W", "--warmup-records", type=int, default=0,
+                    help="Number of records after which the statistics "
+                    "are reset")
+parser.add_argument("--max-records", type=int, default=0,
+                    help="Number of records to replay, 0 for all of them")
+
+args = parser.parse_args()
+
+# Requests are replayed atomically, which is all the tags and the
+# replacement policies need
+system = System(mem_mode = 'atomic',
+                mem_ranges = [AddrRange(args.mem_size)],
+                cache_line_size = args.cacheline_size)
+system.clk_domain = SrcClockDomain(clock = '1GHz',
+                                   voltage_domain = VoltageDomain())
+
+system.replay = CacheReplay(trace_file = args.trace,
+                            warmup_records = args.warmup_records,
+                            max_records = args.max_records)
+
+system.l2 = L2Cache(size = args.l2_size, assoc = args.l2_assoc)
+if args.l2_rp:
+    system.l2.replacement_policy = ObjectList.rp_list.get(args.l2_rp)()
+    # The optimal policy reads the future from the replayed trace
+    if args.l2_rp == "OPTRP":
+        system.l2.replacement_policy.trace_file = args.trace
+if args.num_sc_ways is not None:
+    system.l2.replacement_policy.num_sc_ways = args.num_sc_ways
+
+system.membus = SystemXBar()
+system.replay.port = system.l2.cpu_side
+system.l2.mem_side = system.membus.cpu_side_ports
+system.system_port = system.membus.cpu_side_ports
+
+# The data of the accesses is not in the trace, so do not store it
+system.physmem = SimpleMemory(range = system.mem_ranges[0], null = True)
+system.membus.mem_side_ports = system.physmem.port
+
+root = Root(full_system = False, system = system)
+m5.instantiate()
+
+exit_event = m5.simulate()
+print("Exiting @ tick", m5.curTick(), "because", exit_event.getCause())
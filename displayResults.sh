@@ -2,6 +2,10 @@ echo Shepherd Cache Miss Rates:
 grep -r "system.l2.overallMissRate" m5out_sc*
 grep -r "system.l2.overallAccesses" m5out_sc*
 grep -r "system.cpu.numCycles" m5out_sc*
+echo Shepherd Cache Victim Selection:
+grep -r "system.l2.replacement_policy.lruVictims" m5out_sc*
+grep -r "system.l2.replacement_policy.scVictims" m5out_sc*
+grep -r "system.l2.replacement_policy.deadVictimRatio" m5out_sc*
 echo LRU Miss Rates: 
 grep -r "system.l2.overallMissRate" m5out_lru*
 grep -r "system.l2.overallAccesses" m5out_lru*
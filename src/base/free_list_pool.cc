@@ -0,0 +1,158 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/free_list_pool.hh"
+
+#include <algorithm>
+#include <mutex>
+
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+/** Maximum number of pools. Raise it if more pools are needed. */
+constexpr unsigned MaxPools = 8;
+
+/** A chunk in a free list. */
+struct FreeChunk
+{
+    FreeChunk *next;
+};
+
+/** The state of a pool that is private to a thread. */
+struct ThreadPool
+{
+    /** First chunk of the free list. */
+    FreeChunk *head;
+    /** Usage of the pool by the thread. Null until its first use. */
+    FreeListPool::Counts *counts;
+};
+
+/**
+ * The per-thread state of all the pools. It is trivially constructible,
+ * so accessing it needs no initialization check.
+ */
+thread_local ThreadPool threadPools[MaxPools];
+
+/** Protects the list of pools and the lists of per-thread counts. */
+std::mutex &
+registryMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::vector<FreeListPool *> &
+registry()
+{
+    static std::vector<FreeListPool *> pools;
+    return pools;
+}
+
+/** Usage counts of every thread, indexed by pool. */
+std::vector<std::vector<const FreeListPool::Counts *>> &
+threadCounts()
+{
+    static std::vector<std::vector<const FreeListPool::Counts *>> counts(
+        MaxPools);
+    return counts;
+}
+
+/** Round a chunk size so that consecutive chunks stay aligned. */
+std::size_t
+roundChunkSize(std::size_t size)
+{
+    const std::size_t align = alignof(std::max_align_t);
+    size = std::max(size, sizeof(FreeChunk));
+    return (size + align - 1) / align * align;
+}
+
+} // anonymous namespace
+
+FreeListPool::FreeListPool(const char *name, std::size_t chunk_size)
+    : _name(name), _chunkSize(roundChunkSize(chunk_size)),
+      index(registry().size())
+{
+    std::lock_guard<std::mutex> lock(registryMutex());
+    panic_if(index >= MaxPools, "Too many pools, raise MaxPools.");
+    registry().push_back(this);
+}
+
+void *
+FreeListPool::allocate()
+{
+    ThreadPool &pool = threadPools[index];
+    if (!pool.counts) {
+        // The counts must outlive the thread, so that they can still be
+        // reported, and are thus never freed
+        pool.counts = new Counts();
+        std::lock_guard<std::mutex> lock(registryMutex());
+        threadCounts()[index].push_back(pool.counts);
+    }
+
+    if (FreeChunk *chunk = pool.head) {
+        pool.head = chunk->next;
+        pool.counts->hits++;
+        return chunk;
+    }
+    pool.counts->misses++;
+    return ::operator new(_chunkSize);
+}
+
+void
+FreeListPool::deallocate(void *chunk)
+{
+    ThreadPool &pool = threadPools[index];
+    FreeChunk *free_chunk = static_cast<FreeChunk *>(chunk);
+    free_chunk->next = pool.head;
+    pool.head = free_chunk;
+}
+
+FreeListPool::Counts
+FreeListPool::counts() const
+{
+    std::lock_guard<std::mutex> lock(registryMutex());
+    Counts total;
+    for (const auto *counts : threadCounts()[index]) {
+        total.hits += counts->hits;
+        total.misses += counts->misses;
+    }
+    return total;
+}
+
+const std::vector<FreeListPool *> &
+FreeListPool::pools()
+{
+    return registry();
+}
+
+} // namespace gem5
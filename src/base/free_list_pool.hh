@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_FREE_LIST_POOL_HH__
+#define __BASE_FREE_LIST_POOL_HH__
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+namespace gem5
+{
+
+/**
+ * A pool of fixed size chunks of memory, for objects that are allocated
+ * and freed at a high rate, such as packets. Freed chunks are kept in a
+ * free list and handed out again by the following allocations, so that
+ * most allocations do not reach the heap allocator.
+ *
+ * Each thread has its own free list, so the pool needs no locking. A chunk
+ * may be freed by another thread than the one that allocated it, in which
+ * case it joins the free list of the thread freeing it. Chunks are never
+ * returned to the heap.
+ *
+ * Pools must have static storage duration. They register themselves on
+ * construction so that their usage can be reported in the statistics.
+ */
+class FreeListPool
+{
+  public:
+    /** Number of allocations a pool served, split by origin. */
+    struct Counts
+    {
+        /** Allocations served from a free list. */
+        uint64_t hits = 0;
+        /** Allocations served by the heap. */
+        uint64_t misses = 0;
+    };
+
+  private:
+    /** Name of the pool, used in the statistics. */
+    const char *const _name;
+
+    /** Size of the chunks, in bytes. */
+    const std::size_t _chunkSize;
+
+    /** Index of the pool in the list of pools. */
+    const unsigned index;
+
+  public:
+    /**
+     * @param name Name of the pool, used in the statistics.
+     * @param chunk_size Size of the chunks handed out, in bytes.
+     */
+    FreeListPool(const char *name, std::size_t chunk_size);
+
+    FreeListPool(const FreeListPool &) = delete;
+    FreeListPool &operator=(const FreeListPool &) = delete;
+
+    const char *name() const { return _name; }
+
+    std::size_t chunkSize() const { return _chunkSize; }
+
+    /**
+     * Get a chunk. It is aligned as memory returned by operator new.
+     *
+     * @return The chunk.
+     */
+    void *allocate();
+
+    /**
+     * Give a chunk back to the pool.
+     *
+     * @param chunk A chunk allocated from this pool.
+     */
+    void deallocate(void *chunk);
+
+    /** Get the number of allocations served, over all threads. */
+    Counts counts() const;
+
+    /** Get all the pools, in construction order. */
+    static const std::vector<FreeListPool *> &pools();
+};
+
+/**
+ * A standard allocator that takes single objects from a pool, e.g. the
+ * nodes of a std::list. Arrays, and objects that do not fit in the chunks
+ * of the pool, are allocated on the heap.
+ *
+ * @tparam T The type of the objects allocated.
+ * @tparam Pool The pool to allocate from.
+ */
+template <class T, FreeListPool &Pool>
+class FreeListPoolAllocator
+{
+    static_assert(alignof(T) <= alignof(std::max_align_t),
+        "Pool chunks are only aligned as the fundamental types.");
+
+  public:
+    typedef T value_type;
+
+    template <class U>
+    struct rebind
+    {
+        typedef FreeListPoolAllocator<U, Pool> other;
+    };
+
+    FreeListPoolAllocator() = default;
+
+    template <class U>
+    FreeListPoolAllocator(const FreeListPoolAllocator<U, Pool> &)
+    {
+    }
+
+    T *
+    allocate(std::size_t n)
+    {
+        if (n == 1 && sizeof(T) <= Pool.chunkSize()) {
+            return static_cast<T *>(Pool.allocate());
+        }
+        return static_cast<T *>(::operator new(n * sizeof(T)));
+    }
+
+    void
+    deallocate(T *p, std::size_t n)
+    {
+        if (n == 1 && sizeof(T) <= Pool.chunkSize()) {
+            Pool.deallocate(p);
+        } else {
+            ::operator delete(p);
+        }
+    }
+
+    template <class U>
+    bool
+    operator==(const FreeListPoolAllocator<U, Pool> &) const
+    {
+        return true;
+    }
+
+    template <class U>
+    bool
+    operator!=(const FreeListPoolAllocator<U, Pool> &) const
+    {
+        return false;
+    }
+};
+
+} // namespace gem5
+
+#endif // __BASE_FREE_LIST_POOL_HH__
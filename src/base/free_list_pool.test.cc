@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <list>
+#include <thread>
+
+#include "base/free_list_pool.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+FreeListPool testPool("test", 24);
+FreeListPool listPool("list", 64);
+
+} // anonymous namespace
+
+/** Pools are registered and their chunks keep the fundamental alignment. */
+TEST(FreeListPoolTest, Registration)
+{
+    bool found = false;
+    for (const auto *pool : FreeListPool::pools()) {
+        found |= (pool == &testPool);
+    }
+    ASSERT_TRUE(found);
+    ASSERT_EQ(testPool.chunkSize() % alignof(std::max_align_t), 0);
+    ASSERT_GE(testPool.chunkSize(), 24);
+}
+
+/** Freed chunks are handed out again, and counted as hits. */
+TEST(FreeListPoolTest, Reuse)
+{
+    const FreeListPool::Counts before = testPool.counts();
+
+    void *first = testPool.allocate();
+    void *second = testPool.allocate();
+    ASSERT_NE(first, second);
+    testPool.deallocate(first);
+    testPool.deallocate(second);
+
+    // The free list is last in, first out
+    ASSERT_EQ(testPool.allocate(), second);
+    ASSERT_EQ(testPool.allocate(), first);
+
+    const FreeListPool::Counts after = testPool.counts();
+    ASSERT_EQ(after.hits - before.hits, 2);
+    ASSERT_EQ(after.misses - before.misses, 2);
+
+    testPool.deallocate(first);
+    testPool.deallocate(second);
+}
+
+/** The counts of all threads are summed. */
+TEST(FreeListPoolTest, Threads)
+{
+    const FreeListPool::Counts before = testPool.counts();
+    std::thread thread([]() {
+        void *chunk = testPool.allocate();
+        testPool.deallocate(chunk);
+        testPool.deallocate(testPool.allocate());
+    });
+    thread.join();
+
+    const FreeListPool::Counts after = testPool.counts();
+    ASSERT_EQ(after.hits - before.hits, 1);
+    ASSERT_EQ(after.misses - before.misses, 1);
+}
+
+/** Containers can take their nodes from a pool. */
+TEST(FreeListPoolTest, Allocator)
+{
+    std::list<uint64_t, FreeListPoolAllocator<uint64_t, listPool>> list;
+    const FreeListPool::Counts before = listPool.counts();
+    for (int i = 0; i < 4; i++) {
+        list.push_back(i);
+    }
+    list.clear();
+    for (int i = 0; i < 4; i++) {
+        list.push_back(i);
+    }
+
+    const FreeListPool::Counts after = listPool.counts();
+    ASSERT_EQ(after.misses - before.misses, 4);
+    ASSERT_EQ(after.hits - before.hits, 4);
+    ASSERT_EQ(list.back(), 3);
+}
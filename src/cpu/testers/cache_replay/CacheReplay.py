@@ -0,0 +1,47 @@
+# Copyright (c) 2026 The gem5 Shepherd Cache authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.params import *
+from m5.proxy import *
+from m5.SimObject import SimObject
+
+class CacheReplay(SimObject):
+    type = 'CacheReplay'
+    cxx_header = "cpu/testers/cache_replay/cache_replay.hh"
+    cxx_class = 'gem5::CacheReplay'
+
+    # Packet trace of the requests received by a cache, as recorded by a
+    # MemTraceProbe attached to a CommMonitor placed in front of it
+    trace_file = Param.String("Packet trace to replay")
+
+    # Equivalent of the warmup and run duration of the recorded run
+    warmup_records = Param.Counter(0,
+        "Number of records after which the statistics are reset")
+    max_records = Param.Counter(0,
+        "Number of records to replay, 0 to replay the whole trace")
+
+    port = RequestPort("Port to the memory system")
+    system = Param.System(Parent.any, "System this replayer is part of")
@@ -0,0 +1,200 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/testers/cache_replay/cache_replay.hh"
+
+#include <memory>
+
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/CacheReplay.hh"
+#include "mem/request.hh"
+#include "sim/core.hh"
+#include "sim/cur_tick.hh"
+#include "sim/sim_exit.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+
+bool
+CacheReplay::ReplayPort::recvTimingResp(PacketPtr pkt)
+{
+    panic("%s only replays atomic requests\n", name());
+}
+
+void
+CacheReplay::ReplayPort::recvReqRetry()
+{
+    panic("%s only replays atomic requests\n", name());
+}
+
+CacheReplay::CacheReplay(const Params &p)
+    : SimObject(p),
+      port(name() + ".port", *this),
+      requestorId(p.system->getRequestorId(this)),
+      trace(p.trace_file),
+      warmupRecords(p.warmup_records),
+      maxRecords(p.max_records),
+      numRecords(0),
+      replayEvent([this]{ replay(); }, name()),
+      stats(this)
+{
+}
+
+Port &
+CacheReplay::getPort(const std::string &if_name, PortID idx)
+{
+    if (if_name == "port")
+        return port;
+    else
+        return SimObject::getPort(if_name, idx);
+}
+
+void
+CacheReplay::init()
+{
+    fatal_if(!port.isConnected(), "%s's port is not connected\n", name());
+}
+
+void
+CacheReplay::startup()
+{
+    ProtoMessage::PacketHeader header_msg;
+    panic_if(!trace.read(header_msg),
+             "Failed to read packet header from trace\n");
+    warn_if(header_msg.tick_freq() != sim_clock::Frequency,
+            "Trace recorded with a tick frequency of %d, which does not "
+            "match the simulated one\n", header_msg.tick_freq());
+
+    if (readRecord()) {
+        schedule(replayEvent, std::max(curTick(), Tick(nextRecord.tick())));
+    } else {
+        exitSimLoop("cache trace is empty");
+    }
+}
+
+bool
+CacheReplay::readRecord()
+{
+    if (maxRecords && numRecords == maxRecords) {
+        return false;
+    }
+    if (!trace.read(nextRecord)) {
+        return false;
+    }
+    numRecords++;
+    return true;
+}
+
+MemCmd
+CacheReplay::replayCommand(MemCmd cmd)
+{
+    switch (cmd.toInt()) {
+      case MemCmd::ReadReq:
+      case MemCmd::ReadExReq:
+      case MemCmd::ReadSharedReq:
+      case MemCmd::ReadCleanReq:
+      case MemCmd::WriteReq:
+      case MemCmd::WritebackDirty:
+      case MemCmd::WritebackClean:
+      case MemCmd::CleanEvict:
+        return cmd;
+      case MemCmd::UpgradeReq:
+      case MemCmd::SCUpgradeReq:
+        // The requestor held the block, which the cache may have evicted
+        // since, so ask for a writable copy instead
+        return MemCmd::ReadExReq;
+      default:
+        return MemCmd::InvalidCmd;
+    }
+}
+
+void
+CacheReplay::send(const ProtoMessage::Packet &record)
+{
+    const MemCmd cmd = replayCommand(MemCmd(record.cmd()));
+    if (cmd == MemCmd::InvalidCmd) {
+        DPRINTF(CacheReplay, "Skipping %s to %#x\n",
+                MemCmd(record.cmd()).toString(), record.addr());
+        stats.skippedRecords++;
+        return;
+    }
+
+    RequestPtr req = std::make_shared<Request>(record.addr(), record.size(),
+        record.flags(), requestorId);
+    if (record.has_pc()) {
+        req->setPC(record.pc());
+    }
+
+    if (data.size() < record.size()) {
+        data.resize(record.size());
+    }
+    Packet pkt(req, cmd);
+    pkt.dataStatic(data.data());
+
+    DPRINTF(CacheReplay, "Replaying %s to %#x\n", cmd.toString(),
+            record.addr());
+    port.sendAtomic(&pkt);
+    stats.replayedRecords++;
+}
+
+void
+CacheReplay::replay()
+{
+    do {
+        send(nextRecord);
+
+        // Mirror the warmup of the recorded run. The reset has to take
+        // place between the last warmup record and the next one, even
+        // when both are due on the same tick, so the statistics are reset
+        // right away rather than by a stat event, which would only run
+        // once this event returns.
+        if (numRecords == warmupRecords) {
+            statistics::reset();
+        }
+
+        if (!readRecord()) {
+            exitSimLoop("end of cache trace reached");
+            return;
+        }
+    } while (nextRecord.tick() <= curTick());
+
+    schedule(replayEvent, nextRecord.tick());
+}
+
+CacheReplay::CacheReplayStats::CacheReplayStats(statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(replayedRecords, statistics::units::Count::get(),
+               "Number of records replayed"),
+      ADD_STAT(skippedRecords, statistics::units::Count::get(),
+               "Number of records skipped")
+{
+}
+
+} // namespace gem5
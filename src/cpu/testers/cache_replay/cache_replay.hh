@@ -0,0 +1,163 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of a replayer of packet traces into a cache hierarchy.
+ */
+
+#ifndef __CPU_TESTERS_CACHE_REPLAY_CACHE_REPLAY_HH__
+#define __CPU_TESTERS_CACHE_REPLAY_CACHE_REPLAY_HH__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "mem/packet.hh"
+#include "mem/port.hh"
+#include "params/CacheReplay.hh"
+#include "proto/packet.pb.h"
+#include "proto/protoio.hh"
+#include "sim/eventq.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+/**
+ * The CacheReplay replays a packet trace, as recorded by a MemTraceProbe,
+ * into the memory system it is connected to. It is meant to evaluate
+ * caches, e.g. to sweep replacement policies, without simulating the
+ * CPUs that produced the accesses.
+ *
+ * The requests are sent in atomic mode, so they are processed
+ * functionally, and each record is issued on the tick it was recorded,
+ * which preserves the order the replacement policies see. All the
+ * records of a tick are replayed by a single event, so the cost of the
+ * simulation is proportional to the number of accesses rather than to
+ * the number of cycles.
+ */
+class CacheReplay : public SimObject
+{
+  private:
+    class ReplayPort : public RequestPort
+    {
+      public:
+        ReplayPort(const std::string &_name, CacheReplay &_replay)
+            : RequestPort(_name, &_replay)
+        { }
+
+      protected:
+        bool recvTimingResp(PacketPtr pkt) override;
+
+        void recvReqRetry() override;
+    };
+
+    ReplayPort port;
+
+    /** Request id of the replayed requests. */
+    const RequestorID requestorId;
+
+    /** Stream the records are read from. */
+    ProtoInputStream trace;
+
+    /** Number of records after which the statistics are reset. */
+    const Counter warmupRecords;
+
+    /** Number of records to replay, 0 for the whole trace. */
+    const Counter maxRecords;
+
+    /** Number of records read so far. */
+    Counter numRecords;
+
+    /** Record to replay next. */
+    ProtoMessage::Packet nextRecord;
+
+    /**
+     * Data of the replayed packets. The data of the original accesses is
+     * not in the trace, and the cache only needs somewhere to copy it.
+     */
+    std::vector<uint8_t> data;
+
+    /** Event replaying the records due on the current tick. */
+    EventFunctionWrapper replayEvent;
+
+    /**
+     * Read the next record of the trace.
+     *
+     * @return Whether a record could be read.
+     */
+    bool readRecord();
+
+    /** Replay the records due on the current tick. */
+    void replay();
+
+    /**
+     * Get the command a recorded command is replayed as. Requests that a
+     * cache would not receive from a CPU-side port in atomic mode are
+     * either converted or skipped.
+     *
+     * @param cmd The recorded command.
+     * @return The replayed command, or InvalidCmd to skip the record.
+     */
+    static MemCmd replayCommand(MemCmd cmd);
+
+    /**
+     * Send a recorded request to the memory system.
+     *
+     * @param record The record to replay.
+     */
+    void send(const ProtoMessage::Packet &record);
+
+    struct CacheReplayStats : public statistics::Group
+    {
+        CacheReplayStats(statistics::Group *parent);
+
+        /** Number of records replayed. */
+        statistics::Scalar replayedRecords;
+
+        /** Number of records skipped. */
+        statistics::Scalar skippedRecords;
+    } stats;
+
+  public:
+    PARAMS(CacheReplay);
+    CacheReplay(const Params &p);
+
+    void init() override;
+
+    void startup() override;
+
+    Port &getPort(const std::string &if_name,
+                  PortID idx=InvalidPortID) override;
+};
+
+} // namespace gem5
+
+#endif // __CPU_TESTERS_CACHE_REPLAY_CACHE_REPLAY_HH__
@@ -106,6 +106,15 @@ class BaseCache(ClockedObject):
     replacement_policy = Param.BaseReplacementPolicy(LRURP(),
         "Replacement policy")
 
+    # Alternative tag stores that observe the same access stream as the
+    # cache, but only track tags. Each reports its own hits and misses, so
+    # that several organizations or replacement policies can be compared
+    # in a single run, e.g.:
+    #   shadow_tags = [BaseSetAssoc(replacement_policy=SCRP(num_sc_ways=n))
+    #                  for n in (2, 4, 8)]
+    # Each shadow tag store must be given its own replacement policy.
+    shadow_tags = VectorParam.BaseTags([], "Shadow tag stores")
+
     compressor = Param.BaseCacheCompressor(NULL, "Cache compressor.")
     replace_expansions = Param.Bool(True, "Apply replacement policy to " \
         "decide which blocks should be evicted on a data expansion")
@@ -152,6 +161,12 @@ class BaseCache(ClockedObject):
     # data cache.
     write_allocator = Param.WriteAllocator(NULL, "Write allocator")
 
+    # Save the blocks of the cache, dirty data included, in checkpoints,
+    # so that a restored cache is already warm. Replacement policies that
+    # support it also save their state.
+    checkpoint_contents = Param.Bool(False,
+        "Whether checkpoints hold the contents of the cache")
+
 class Cache(BaseCache):
     type = 'Cache'
     cxx_header = 'mem/cache/cache.hh'
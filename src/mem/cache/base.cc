@@ -45,6 +45,10 @@
 
 #include "mem/cache/base.hh"
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 #include "base/compiler.hh"
 #include "base/logging.hh"
 #include "debug/Cache.hh"
@@ -60,6 +64,8 @@
 #include "mem/cache/tags/compressed_tags.hh"
 #include "mem/cache/tags/super_blk.hh"
 #include "params/BaseCache.hh"
+#include "params/BaseSetAssoc.hh"
+#include "params/SectorTags.hh"
 #include "params/WriteAllocator.hh"
 #include "sim/cur_tick.hh"
 
@@ -83,6 +89,7 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
       mshrQueue("MSHRs", p.mshrs, 0, p.demand_mshr_reserve, p.name),
       writeBuffer("write buffer", p.write_buffers, p.mshrs, p.name),
       tags(p.tags),
+      shadowTags(p.shadow_tags),
       compressor(p.compressor),
       prefetcher(p.prefetcher),
       writeAllocator(p.write_allocator),
@@ -104,6 +111,7 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
       isReadOnly(p.is_read_only),
       replaceExpansions(p.replace_expansions),
       moveContractions(p.move_contractions),
+      checkpointContents(p.checkpoint_contents),
       blocked(0),
       order(0),
       noTargetMSHR(nullptr),
@@ -124,6 +132,31 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
     tempBlock = new TempCacheBlk(blkSize);
 
     tags->tagsInit();
+    // The replacement policies keep per-table state, so no two tag stores
+    // of the cache can share one
+    std::vector<replacement_policy::Base*> policies = {p.replacement_policy};
+    for (BaseTags *shadow : shadowTags) {
+        fatal_if(dynamic_cast<CompressedTags*>(shadow),
+                 "Shadow tags of %s cannot be compressed", name());
+        const auto *assoc_p =
+            dynamic_cast<const BaseSetAssocParams*>(&shadow->params());
+        const auto *sector_p =
+            dynamic_cast<const SectorTagsParams*>(&shadow->params());
+        replacement_policy::Base *policy =
+            assoc_p ? assoc_p->replacement_policy :
+            sector_p ? sector_p->replacement_policy : nullptr;
+        if (policy) {
+            fatal_if(std::find(policies.begin(), policies.end(), policy) !=
+                     policies.end(),
+                     "Shadow tags of %s need their own replacement policy",
+                     name());
+            policies.push_back(policy);
+        }
+        shadow->tagsInit();
+    }
+    if (!shadowTags.empty()) {
+        shadowStats.reset(new ShadowTagsStats(*this));
+    }
     if (prefetcher)
         prefetcher->setCache(this);
 
@@ -339,6 +372,17 @@ BaseCache::handleTimingReqMiss(PacketPtr pkt, MSHR *mshr, CacheBlk *blk,
                 assert(pkt->req->requestorId() < system->maxRequestors());
                 stats.cmdStats(pkt).mshrHits[pkt->req->requestorId()]++;
 
+                // A demand coalescing into an MSHR that only holds a
+                // prefetch means that the prefetch was issued too late.
+                // The block is now needed, so the replacement policy
+                // must not insert it with the priority of the prefetch.
+                if (prefetcher && pkt->isDemand() &&
+                    mshr->getNumTargets() == 1 &&
+                    mshr->getTarget()->pkt->cmd == MemCmd::HardPFReq) {
+                    prefetcher->prefetchLate(mshr->getTarget()->pkt);
+                    mshr->getTarget()->pkt->req->clearPrefetchPriority();
+                }
+
                 // We use forward_time here because it is the same
                 // considering new targets. We have multiple
                 // requests for the same address here. It
@@ -903,19 +947,19 @@ BaseCache::getNextQueueEntry()
             if (tags->findBlock(pf_addr, pkt->isSecure())) {
                 DPRINTF(HWPrefetch, "Prefetch %#x has hit in cache, "
                         "dropped.\n", pf_addr);
-                prefetcher->pfHitInCache();
+                prefetcher->pfHitInCache(pkt);
                 // free the request and packet
                 delete pkt;
             } else if (mshrQueue.findMatch(pf_addr, pkt->isSecure())) {
                 DPRINTF(HWPrefetch, "Prefetch %#x has hit in a MSHR, "
                         "dropped.\n", pf_addr);
-                prefetcher->pfHitInMSHR();
+                prefetcher->pfHitInMSHR(pkt);
                 // free the request and packet
                 delete pkt;
             } else if (writeBuffer.findMatch(pf_addr, pkt->isSecure())) {
                 DPRINTF(HWPrefetch, "Prefetch %#x has hit in the "
                         "Write Buffer, dropped.\n", pf_addr);
-                prefetcher->pfHitInWB();
+                prefetcher->pfHitInWB(pkt);
                 // free the request and packet
                 delete pkt;
             } else {
@@ -1224,6 +1268,49 @@ BaseCache::calculateAccessLatency(const CacheBlk* blk, const uint32_t delay,
     return lat;
 }
 
+void
+BaseCache::accessShadowTags(const PacketPtr pkt)
+{
+    // A clean eviction does not allocate, and does not count as an access
+    if (pkt->isCleanEviction()) {
+        return;
+    }
+    const bool is_writeback = pkt->isEviction();
+
+    std::vector<CacheBlk*> evict_blks;
+    for (std::size_t i = 0; i < shadowTags.size(); i++) {
+        BaseTags *shadow = shadowTags[i];
+
+        Cycles lat;
+        if (shadow->accessBlock(pkt, lat)) {
+            if (!is_writeback) {
+                shadowStats->hits[i]++;
+            }
+            continue;
+        }
+        if (!is_writeback) {
+            shadowStats->misses[i]++;
+            if (!allocOnFill(pkt->cmd)) {
+                continue;
+            }
+        }
+
+        // Only the tags are tracked, so victims are simply dropped
+        evict_blks.clear();
+        CacheBlk *victim = shadow->findVictim(pkt->getAddr(),
+            pkt->isSecure(), blkSize * 8, evict_blks);
+        if (!victim) {
+            continue;
+        }
+        for (CacheBlk *blk : evict_blks) {
+            if (blk->isValid()) {
+                shadow->invalidate(blk);
+            }
+        }
+        shadow->insertBlock(pkt, victim);
+    }
+}
+
 bool
 BaseCache::access(PacketPtr pkt, CacheBlk *&blk, Cycles &lat,
                   PacketList &writebacks)
@@ -1242,6 +1329,10 @@ BaseCache::access(PacketPtr pkt, CacheBlk *&blk, Cycles &lat,
     DPRINTF(Cache, "%s for %s %s\n", __func__, pkt->print(),
             blk ? "hit " + blk->print() : "miss");
 
+    if (!shadowTags.empty() && !pkt->req->isCacheMaintenance()) {
+        accessShadowTags(pkt);
+    }
+
     if (pkt->req->isCacheMaintenance()) {
         // A cache maintenance operation is always forwarded to the
         // memory below even if the block is found in dirty state.
@@ -1640,11 +1731,28 @@ BaseCache::allocateBlock(const PacketPtr pkt, PacketList &writebacks)
     // Print victim block's information
     DPRINTF(CacheRepl, "Replacement victim: %s\n", victim->print());
 
+    // Keep the addresses of the blocks a prefetch evicts, so that its
+    // prefetcher can tell whether it is polluting the cache
+    std::vector<std::pair<Addr, bool>> pf_evicted;
+    if (prefetcher && pkt->cmd == MemCmd::HardPFResp) {
+        for (const auto& blk : evict_blks) {
+            if (blk->isValid()) {
+                pf_evicted.emplace_back(regenerateBlkAddr(blk),
+                                        blk->isSecure());
+            }
+        }
+    }
+
     // Try to evict blocks; if it fails, give up on allocation
     if (!handleEvictions(evict_blks, writebacks)) {
         return nullptr;
     }
 
+    for (const auto& [evicted_addr, evicted_secure] : pf_evicted) {
+        prefetcher->prefetchEviction(evicted_addr, evicted_secure,
+                                     pkt->req->requestorId());
+    }
+
     // Insert new block at victimized entry
     tags->insertBlock(pkt, victim);
 
@@ -1663,7 +1771,8 @@ BaseCache::invalidateBlock(CacheBlk *blk)
 {
     // If block is still marked as prefetched, then it hasn't been used
     if (blk->wasPrefetched()) {
-        prefetcher->prefetchUnused();
+        prefetcher->prefetchUnused(regenerateBlkAddr(blk), blk->isSecure(),
+                                   blk->getSrcRequestorId());
     }
 
     // Notify that the data contents for this address are no longer present
@@ -1988,9 +2097,127 @@ BaseCache::sendWriteQueuePacket(WriteQueueEntry* wq_entry)
     }
 }
 
+void
+BaseCache::serializeBlocks(CheckpointOut &cp) const
+{
+    unsigned blk_size = blkSize;
+    unsigned num_blks = 0;
+    std::vector<unsigned> blk_index;
+    std::vector<Addr> blk_addr;
+    std::vector<uint8_t> blk_secure;
+    std::vector<unsigned> blk_coherence;
+    std::vector<uint8_t> blk_prefetched;
+    std::vector<RequestorID> blk_requestor;
+    std::vector<uint32_t> blk_task;
+    std::vector<uint8_t> blk_data;
+
+    tags->forEachBlk([&](CacheBlk &blk) {
+        if (blk.isValid()) {
+            blk_index.push_back(num_blks);
+            blk_addr.push_back(tags->regenerateBlkAddr(&blk));
+            blk_secure.push_back(blk.isSecure());
+            unsigned coherence = 0;
+            for (const unsigned bit : {CacheBlk::WritableBit,
+                    CacheBlk::ReadableBit, CacheBlk::DirtyBit}) {
+                if (blk.isSet(bit)) {
+                    coherence |= bit;
+                }
+            }
+            blk_coherence.push_back(coherence);
+            blk_prefetched.push_back(blk.wasPrefetched());
+            blk_requestor.push_back(blk.getSrcRequestorId());
+            blk_task.push_back(blk.getTaskId());
+            blk_data.insert(blk_data.end(), blk.data, blk.data + blkSize);
+        }
+        num_blks++;
+    });
+
+    SERIALIZE_SCALAR(blk_size);
+    SERIALIZE_SCALAR(num_blks);
+    SERIALIZE_CONTAINER(blk_index);
+    SERIALIZE_CONTAINER(blk_addr);
+    SERIALIZE_CONTAINER(blk_secure);
+    SERIALIZE_CONTAINER(blk_coherence);
+    SERIALIZE_CONTAINER(blk_prefetched);
+    SERIALIZE_CONTAINER(blk_requestor);
+    SERIALIZE_CONTAINER(blk_task);
+    SERIALIZE_CONTAINER(blk_data);
+}
+
+void
+BaseCache::unserializeBlocks(CheckpointIn &cp)
+{
+    unsigned blk_size;
+    unsigned num_blks;
+    std::vector<unsigned> blk_index;
+    std::vector<Addr> blk_addr;
+    std::vector<uint8_t> blk_secure;
+    std::vector<unsigned> blk_coherence;
+    std::vector<uint8_t> blk_prefetched;
+    std::vector<RequestorID> blk_requestor;
+    std::vector<uint32_t> blk_task;
+    std::vector<uint8_t> blk_data;
+
+    UNSERIALIZE_SCALAR(blk_size);
+    UNSERIALIZE_SCALAR(num_blks);
+    UNSERIALIZE_CONTAINER(blk_index);
+    UNSERIALIZE_CONTAINER(blk_addr);
+    UNSERIALIZE_CONTAINER(blk_secure);
+    UNSERIALIZE_CONTAINER(blk_coherence);
+    UNSERIALIZE_CONTAINER(blk_prefetched);
+    UNSERIALIZE_CONTAINER(blk_requestor);
+    UNSERIALIZE_CONTAINER(blk_task);
+    UNSERIALIZE_CONTAINER(blk_data);
+
+    std::vector<CacheBlk*> blks;
+    tags->forEachBlk([&](CacheBlk &blk) { blks.push_back(&blk); });
+    fatal_if(blk_size != blkSize || num_blks != blks.size(),
+             "%s: The checkpointed cache had %u blocks of %u bytes, but "
+             "this one has %u blocks of %u bytes.\n", name(), num_blks,
+             blk_size, blks.size(), blkSize);
+    fatal_if(compressor, "%s: Restoring the contents of compressed caches "
+             "is not supported.\n", name());
+    assert(blk_data.size() == blk_index.size() * blkSize);
+
+    for (std::size_t i = 0; i < blk_index.size(); i++) {
+        CacheBlk *blk = blks[blk_index[i]];
+        assert(!blk->isValid());
+
+        // Requestors that do not exist anymore are accounted as writebacks
+        RequestorID requestor = blk_requestor[i];
+        if (requestor >= system->maxRequestors()) {
+            requestor = Request::wbRequestorId;
+        }
+        const Request::FlagsType flags =
+            blk_secure[i] ? Request::SECURE : Request::FlagsType(0);
+        RequestPtr req = std::make_shared<Request>(blk_addr[i], blkSize,
+            flags, requestor);
+        req->taskId(blk_task[i]);
+        Packet pkt(req, MemCmd::ReadReq);
+
+        tags->insertBlock(&pkt, blk);
+        blk->setCoherenceBits(blk_coherence[i]);
+        if (blk_prefetched[i]) {
+            blk->setPrefetched();
+        }
+        std::memcpy(blk->data, &blk_data[i * blkSize], blkSize);
+    }
+}
+
 void
 BaseCache::serialize(CheckpointOut &cp) const
 {
+    bool has_contents(checkpointContents);
+    SERIALIZE_SCALAR(has_contents);
+    if (has_contents) {
+        serializeBlocks(cp);
+
+        // Dirty data is in the checkpoint, so it restores correctly
+        bool bad_checkpoint(false);
+        SERIALIZE_SCALAR(bad_checkpoint);
+        return;
+    }
+
     bool dirty(isDirty());
 
     if (dirty) {
@@ -2011,6 +2238,12 @@ BaseCache::serialize(CheckpointOut &cp) const
 void
 BaseCache::unserialize(CheckpointIn &cp)
 {
+    bool has_contents = false;
+    UNSERIALIZE_OPT_SCALAR(has_contents);
+    if (has_contents) {
+        unserializeBlocks(cp);
+    }
+
     bool bad_checkpoint;
     UNSERIALIZE_SCALAR(bad_checkpoint);
     if (bad_checkpoint) {
@@ -2502,6 +2735,40 @@ BaseCache::CacheStats::regStats()
     dataContractions.flags(nozero | nonan);
 }
 
+BaseCache::ShadowTagsStats::ShadowTagsStats(BaseCache &c)
+    : statistics::Group(&c, "shadowTags"), cache(c),
+    ADD_STAT(hits, statistics::units::Count::get(),
+             "number of hits in each shadow tag store"),
+    ADD_STAT(misses, statistics::units::Count::get(),
+             "number of misses in each shadow tag store"),
+    ADD_STAT(missRate, statistics::units::Ratio::get(),
+             "miss rate of each shadow tag store")
+{
+}
+
+void
+BaseCache::ShadowTagsStats::regStats()
+{
+    using namespace statistics;
+
+    statistics::Group::regStats();
+
+    const auto num_shadows = cache.shadowTags.size();
+    hits.init(num_shadows);
+    misses.init(num_shadows);
+    for (std::size_t i = 0; i < num_shadows; i++) {
+        // Name the entries after the shadow tag stores themselves
+        const std::string &shadow_name = cache.shadowTags[i]->name();
+        const std::string subname =
+            shadow_name.substr(shadow_name.rfind('.') + 1);
+        hits.subname(i, subname);
+        misses.subname(i, subname);
+    }
+
+    missRate.flags(nonan);
+    missRate = misses / (hits + misses);
+}
+
 void
 BaseCache::regProbePoints()
 {
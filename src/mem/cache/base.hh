@@ -48,7 +48,9 @@
 
 #include <cassert>
 #include <cstdint>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "base/addr_range.hh"
 #include "base/compiler.hh"
@@ -349,6 +351,13 @@ class BaseCache : public ClockedObject
     /** Tag and data Storage */
     BaseTags *tags;
 
+    /**
+     * Tag stores that are looked up and filled with the same accesses as
+     * tags, without holding data nor affecting the cache. They measure the
+     * miss ratio that other organizations would have had.
+     */
+    const std::vector<BaseTags*> shadowTags;
+
     /** Compression method being used. */
     compression::Base* compressor;
 
@@ -480,6 +489,15 @@ class BaseCache : public ClockedObject
     Cycles calculateAccessLatency(const CacheBlk* blk, const uint32_t delay,
                                   const Cycles lookup_lat) const;
 
+    /**
+     * Replay an access on the shadow tag stores. Requests that miss are
+     * inserted if the cache would allocate them on fill, and writebacks
+     * are inserted without being accounted as accesses.
+     *
+     * @param pkt The request being accessed.
+     */
+    void accessShadowTags(const PacketPtr pkt);
+
     /**
      * Does all the processing necessary to perform the provided request.
      * @param pkt The memory request to perform.
@@ -958,6 +976,9 @@ class BaseCache : public ClockedObject
      */
     const bool moveContractions;
 
+    /** Whether checkpoints hold the contents of the cache. */
+    const bool checkpointContents;
+
     /**
      * Bit vector of the blocking reasons for the access path.
      * @sa #BlockedCause
@@ -1146,6 +1167,26 @@ class BaseCache : public ClockedObject
         std::vector<std::unique_ptr<CacheCmdStats>> cmd;
     } stats;
 
+    /** Statistics of the shadow tag stores, indexed like shadowTags. */
+    struct ShadowTagsStats : public statistics::Group
+    {
+        ShadowTagsStats(BaseCache &c);
+
+        void regStats() override;
+
+        const BaseCache &cache;
+
+        /** Number of accesses that hit in each shadow tag store. */
+        statistics::Vector hits;
+        /** Number of accesses that missed in each shadow tag store. */
+        statistics::Vector misses;
+        /** Miss rate of each shadow tag store. */
+        statistics::Formula missRate;
+    };
+
+    /** Only created when there are shadow tag stores. */
+    std::unique_ptr<ShadowTagsStats> shadowStats;
+
     /** Registers probes. */
     void regProbePoints() override;
 
@@ -1289,6 +1330,40 @@ class BaseCache : public ClockedObject
         }
     }
 
+    bool hasBeenPrefetched(Addr addr, bool is_secure,
+                           RequestorID requestor) const {
+        CacheBlk *block = tags->findBlock(addr, is_secure);
+        if (block) {
+            return block->wasPrefetched() &&
+                   (block->getSrcRequestorId() == requestor);
+        } else {
+            return false;
+        }
+    }
+
+    /**
+     * Find the requestor of the prefetch that filled a block, if the block
+     * has not been accessed since.
+     *
+     * @param addr The address of the block.
+     * @param is_secure Whether the block is in the secure space.
+     * @param requestor Set to the requestor ID of the prefetch.
+     * @return Whether the block is present and unused since prefetched.
+     */
+    bool prefetchSource(Addr addr, bool is_secure,
+                        RequestorID &requestor) const {
+        CacheBlk *block = tags->findBlock(addr, is_secure);
+        if (block && block->wasPrefetched()) {
+            requestor = block->getSrcRequestorId();
+            return true;
+        } else {
+            return false;
+        }
+    }
+
+    /** The prefetcher attached to this cache, if any. */
+    prefetch::Base *getPrefetcher() const { return prefetcher; }
+
     bool inMissQueue(Addr addr, bool is_secure) const {
         return mshrQueue.findMatch(addr, is_secure);
     }
@@ -1351,10 +1426,25 @@ class BaseCache : public ClockedObject
      */
     bool sendWriteQueuePacket(WriteQueueEntry* wq_entry);
 
+    /**
+     * Save the valid blocks of the cache, with their addresses, coherence
+     * state and data, in a checkpoint. The blocks are identified by their
+     * position in the tag store, so a restoring cache must have the same
+     * geometry.
+     */
+    void serializeBlocks(CheckpointOut &cp) const;
+
+    /**
+     * Restore the blocks saved by serializeBlocks(). The blocks are
+     * inserted through the tag store, as on a fill.
+     */
+    void unserializeBlocks(CheckpointIn &cp);
+
     /**
      * Serialize the state of the caches
      *
-     * We currently don't support checkpointing cache state, so this panics.
+     * Unless checkpointContents is set, the contents of the cache are not
+     * checkpointed, so the cache must not hold dirty data.
      */
     void serialize(CheckpointOut &cp) const override;
     void unserialize(CheckpointIn &cp) override;
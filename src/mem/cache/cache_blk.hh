@@ -50,6 +50,7 @@
 #include <cstdint>
 #include <iosfwd>
 #include <list>
+#include <memory>
 #include <string>
 
 #include "base/printable.hh"
@@ -69,6 +70,20 @@ namespace gem5
  */
 class CacheBlk : public TaggedEntry
 {
+    // The narrow fields are declared first, so that they are packed in the
+    // tail padding of TaggedEntry. Large caches instantiate millions of
+    // blocks, so every byte of metadata counts.
+  protected:
+    /** The current coherence status of this block. @sa CoherenceBits */
+    uint8_t coherence;
+
+  private:
+    /** Whether this block is an unaccessed hardware prefetch. */
+    bool _prefetched = false;
+
+    /** holds the source requestor ID for this block. */
+    RequestorID _srcRequestorId = 0;
+
   public:
     /**
      * Cache block's enum listing the supported coherence bits. The valid
@@ -148,8 +163,9 @@ class CacheBlk : public TaggedEntry
     };
 
     /** List of thread contexts that have performed a load-locked (LL)
-     * on the block since the last store. */
-    std::list<Lock> lockList;
+     * on the block since the last store. Only blocks that were ever load
+     * locked allocate it. */
+    std::unique_ptr<std::list<Lock>> lockList;
 
   public:
     CacheBlk()
@@ -208,7 +224,7 @@ class CacheBlk : public TaggedEntry
         setWhenReady(MaxTick);
         setRefCount(0);
         setSrcRequestorId(Request::invldRequestorId);
-        lockList.clear();
+        lockList.reset();
     }
 
     /**
@@ -327,15 +343,18 @@ class CacheBlk : public TaggedEntry
     void trackLoadLocked(PacketPtr pkt)
     {
         assert(pkt->isLLSC());
-        auto l = lockList.begin();
-        while (l != lockList.end()) {
+        if (!lockList) {
+            lockList.reset(new std::list<Lock>());
+        }
+        auto l = lockList->begin();
+        while (l != lockList->end()) {
             if (l->intersects(pkt->req))
-                l = lockList.erase(l);
+                l = lockList->erase(l);
             else
                 ++l;
         }
 
-        lockList.emplace_front(pkt->req);
+        lockList->emplace_front(pkt->req);
     }
 
     /**
@@ -344,10 +363,13 @@ class CacheBlk : public TaggedEntry
      */
     void clearLoadLocks(const RequestPtr &req)
     {
-        auto l = lockList.begin();
-        while (l != lockList.end()) {
+        if (!lockList) {
+            return;
+        }
+        auto l = lockList->begin();
+        while (l != lockList->end()) {
             if (l->intersects(req) && l->contextId != req->contextId()) {
-                l = lockList.erase(l);
+                l = lockList->erase(l);
             } else {
                 ++l;
             }
@@ -414,7 +436,7 @@ class CacheBlk : public TaggedEntry
         assert(pkt->isWrite());
 
         // common case
-        if (!pkt->isLLSC() && lockList.empty())
+        if (!pkt->isLLSC() && (!lockList || lockList->empty()))
             return true;
 
         const RequestPtr &req = pkt->req;
@@ -424,16 +446,18 @@ class CacheBlk : public TaggedEntry
             // load locked.
             bool success = false;
 
-            auto l = lockList.begin();
-            while (!success && l != lockList.end()) {
-                if (l->matches(pkt->req)) {
-                    // it's a store conditional, and as far as the
-                    // memory system can tell, the requesting
-                    // context's lock is still valid.
-                    success = true;
-                    lockList.erase(l);
-                } else {
-                    ++l;
+            if (lockList) {
+                auto l = lockList->begin();
+                while (!success && l != lockList->end()) {
+                    if (l->matches(pkt->req)) {
+                        // it's a store conditional, and as far as the
+                        // memory system can tell, the requesting
+                        // context's lock is still valid.
+                        success = true;
+                        lockList->erase(l);
+                    } else {
+                        ++l;
+                    }
                 }
             }
 
@@ -452,9 +476,6 @@ class CacheBlk : public TaggedEntry
     }
 
   protected:
-    /** The current coherence status of this block. @sa CoherenceBits */
-    unsigned coherence;
-
     // The following setters have been marked as protected because their
     // respective variables should only be modified at 2 moments:
     // invalidation and insertion. Because of that, they shall only be
@@ -476,9 +497,6 @@ class CacheBlk : public TaggedEntry
     /** Task Id associated with this block */
     uint32_t _taskId = 0;
 
-    /** holds the source requestor ID for this block. */
-    int _srcRequestorId = 0;
-
     /** Number of references to this block since it was brought in. */
     unsigned _refCount = 0;
 
@@ -487,9 +505,6 @@ class CacheBlk : public TaggedEntry
      * meaningful if the block is valid.
      */
     Tick _tickInserted = 0;
-
-    /** Whether this block is an unaccessed hardware prefetch. */
-    bool _prefetched = 0;
 };
 
 /**
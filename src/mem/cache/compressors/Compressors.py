@@ -53,6 +53,10 @@ class BaseCacheCompressor(SimObject):
     decomp_extra_latency = Param.Cycles(1, "Number of extra cycles required "
         "to finish decompression (e.g., due to shifting and packaging).")
 
+    memo_entries = Param.Unsigned(0, "Number of entries of the memo that "
+        "stores the compression results of recently seen line contents, so "
+        "that they are not compressed again (0 to disable).")
+
 class BaseDictionaryCompressor(BaseCacheCompressor):
     type = 'BaseDictionaryCompressor'
     abstract = True
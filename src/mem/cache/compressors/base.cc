@@ -36,6 +36,7 @@
 #include <climits>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <string>
 
 #include "base/logging.hh"
@@ -89,7 +90,8 @@ Base::Base(const Params &p)
     compExtraLatency(p.comp_extra_latency),
     decompChunksPerCycle(p.decomp_chunks_per_cycle),
     decompExtraLatency(p.decomp_extra_latency),
-    cache(nullptr), stats(*this)
+    cache(nullptr), memo(p.memo_entries),
+    memoLines(p.memo_entries * (blkSize / sizeof(uint64_t))), stats(*this)
 {
     fatal_if(64 % chunkSizeBits,
         "64 must be a multiple of the chunk granularity.");
@@ -109,6 +111,21 @@ Base::setCache(BaseCache *_cache)
 {
     assert(!cache);
     cache = _cache;
+
+    fatal_if(!memo.empty() && dependsOnHistory(), "%s: the results of "
+        "this compressor depend on previous compressions, so they cannot "
+        "be memoized.", name());
+}
+
+uint64_t
+Base::hashLine(const uint64_t* data) const
+{
+    uint64_t hash = 0;
+    for (std::size_t i = 0; i < blkSize / sizeof(uint64_t); i++) {
+        hash = (hash ^ data[i]) * 0x9e3779b97f4a7c15ULL;
+        hash ^= hash >> 32;
+    }
+    return hash;
 }
 
 std::vector<Base::Chunk>
@@ -150,9 +167,48 @@ Base::fromChunks(const std::vector<Chunk>& chunks, uint64_t* data) const
 std::unique_ptr<Base::CompressionData>
 Base::compress(const uint64_t* data, Cycles& comp_lat, Cycles& decomp_lat)
 {
+    std::unique_ptr<CompressionData> comp_data;
+
+    // Look for the result of a previous compression of the same contents.
+    // Memoized results cannot be decompressed, so the memo is not used
+    // when debugging compression
+    MemoEntry* memo_entry = nullptr;
+    uint64_t* memo_line = nullptr;
+    #ifndef DEBUG_COMPRESSION
+    if (!memo.empty()) {
+        const uint64_t hash = hashLine(data);
+        const std::size_t index = hash % memo.size();
+        memo_entry = &memo[index];
+        memo_line = &memoLines[index * (blkSize / sizeof(uint64_t))];
+        if (memo_entry->valid && (memo_entry->hash == hash) &&
+            !std::memcmp(memo_line, data, blkSize)) {
+            stats.memoHits++;
+            comp_data.reset(new CompressionData());
+            comp_data->setSizeBits(memo_entry->sizeBits);
+            comp_lat = memo_entry->compLat;
+            decomp_lat = memo_entry->decompLat;
+            memo_entry = nullptr;
+        } else {
+            stats.memoMisses++;
+            memo_entry->valid = false;
+            memo_entry->hash = hash;
+        }
+    }
+    #endif
+
     // Apply compression
-    std::unique_ptr<CompressionData> comp_data =
-        compress(toChunks(data), comp_lat, decomp_lat);
+    if (!comp_data) {
+        comp_data = compress(toChunks(data), comp_lat, decomp_lat);
+
+        // Store the result for future compressions of the same contents
+        if (memo_entry) {
+            memo_entry->valid = true;
+            memo_entry->sizeBits = comp_data->getSizeBits();
+            memo_entry->compLat = comp_lat;
+            memo_entry->decompLat = decomp_lat;
+            std::memcpy(memo_line, data, blkSize);
+        }
+    }
 
     // If we are in debug mode apply decompression just after the compression.
     // If the results do not match, we've got an error
@@ -246,7 +302,13 @@ Base::BaseStats::BaseStats(Base& _compressor)
                 statistics::units::Bit, statistics::units::Count>::get(),
              "Average compression size"),
     ADD_STAT(decompressions, statistics::units::Count::get(),
-             "Total number of decompressions")
+             "Total number of decompressions"),
+    ADD_STAT(memoHits, statistics::units::Count::get(),
+             "Number of compressions whose result was memoized"),
+    ADD_STAT(memoMisses, statistics::units::Count::get(),
+             "Number of compressions whose result was not memoized"),
+    ADD_STAT(memoHitRate, statistics::units::Ratio::get(),
+             "Ratio of compressions whose result was memoized")
 {
 }
 
@@ -270,6 +332,9 @@ Base::BaseStats::regStats()
     avgCompressionSizeBits.flags(statistics::total | statistics::nozero |
         statistics::nonan);
     avgCompressionSizeBits = compressionSizeBits / compressions;
+
+    memoHitRate.flags(statistics::nozero | statistics::nonan);
+    memoHitRate = memoHits / (memoHits + memoMisses);
 }
 
 } // namespace compression
@@ -37,6 +37,7 @@
 #define __MEM_CACHE_COMPRESSORS_BASE_HH__
 
 #include <cstdint>
+#include <vector>
 
 #include "base/compiler.hh"
 #include "base/statistics.hh"
@@ -129,6 +130,40 @@ class Base : public SimObject
     /** Pointer to the parent cache. */
     BaseCache* cache;
 
+    /**
+     * An entry of the memo of compression results. Workloads often write
+     * back the same line contents over and over (e.g., zeroed or freshly
+     * initialized lines), and compressing them again always yields the
+     * same result. The memo is a simulation speedup only, so hits have
+     * the latencies of a regular compression.
+     */
+    struct MemoEntry
+    {
+        /** Whether the entry holds a result. */
+        bool valid = false;
+
+        /** Hash of the line contents. */
+        uint64_t hash = 0;
+
+        /** Compressed size, in bits, before applying the size threshold. */
+        std::size_t sizeBits = 0;
+
+        /** Compression latency. */
+        Cycles compLat;
+
+        /** Decompression latency. */
+        Cycles decompLat;
+    };
+
+    /** Direct-mapped memo of compression results, indexed by line hash. */
+    std::vector<MemoEntry> memo;
+
+    /**
+     * Copies of the lines of the memo entries, blkSize bytes per entry.
+     * Hits are confirmed against them, so hash collisions are harmless.
+     */
+    std::vector<uint64_t> memoLines;
+
     struct BaseStats : public statistics::Group
     {
         const Base& compressor;
@@ -154,8 +189,34 @@ class Base : public SimObject
 
         /** Number of decompressions performed. */
         statistics::Scalar decompressions;
+
+        /** Number of compressions whose result was found in the memo. */
+        statistics::Scalar memoHits;
+
+        /** Number of compressions whose result was not in the memo. */
+        statistics::Scalar memoMisses;
+
+        /** Ratio of compressions whose result was found in the memo. */
+        statistics::Formula memoHitRate;
     } stats;
 
+    /**
+     * Hash the contents of a cache line.
+     *
+     * @param data The cache line.
+     * @return The hash of the line.
+     */
+    uint64_t hashLine(const uint64_t* data) const;
+
+    /**
+     * Whether the result of a compression depends on the lines compressed
+     * before it, rather than only on the line being compressed. Results
+     * of such compressors cannot be memoized.
+     *
+     * @return True if the compressor is stateful.
+     */
+    virtual bool dependsOnHistory() const { return false; }
+
     /**
      * This function splits the raw data into chunks, so that it can be
      * parsed by the compressor.
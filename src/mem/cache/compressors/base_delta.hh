@@ -37,6 +37,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "base/bitfield.hh"
 #include "mem/cache/compressors/dictionary_compressor.hh"
@@ -107,6 +108,15 @@ class BaseDelta : public DictionaryCompressor<BaseType>
         return PatternFactory::getPattern(bytes, dict_bytes, match_location);
     }
 
+    std::size_t
+    getPatternSizeBits(const DictionaryEntry& bytes,
+        const DictionaryEntry& dict_bytes,
+        const int match_location) const override
+    {
+        return PatternFactory::getPatternSizeBits(bytes, dict_bytes,
+                                                  match_location);
+    }
+
     std::string
     getName(int number) const override
     {
@@ -121,6 +131,27 @@ class BaseDelta : public DictionaryCompressor<BaseType>
 
     void addToDictionary(DictionaryEntry data) override;
 
+    /** Scratch copy of the values of the line being compressed. */
+    std::vector<BaseType> lineValues;
+
+    /**
+     * Scratch dictionary location each value of the line matches, or -1
+     * if the value becomes a new base.
+     */
+    std::vector<int> matchLocations;
+
+    /**
+     * Compress a line by matching all of its values against each base at
+     * once, instead of every value against every base in turn. The bases
+     * are still allocated in the order of the values, so the resulting
+     * patterns are the same as the ones found value by value.
+     *
+     * @param chunks The cache line to be compressed.
+     * @return Cache line after compression.
+     */
+    std::unique_ptr<Base::CompressionData> compress(
+        const std::vector<Base::Chunk>& chunks) override;
+
     std::unique_ptr<Base::CompressionData> compress(
         const std::vector<Base::Chunk>& chunks,
         Cycles& comp_lat, Cycles& decomp_lat) override;
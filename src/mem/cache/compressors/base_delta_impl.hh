@@ -33,8 +33,10 @@
 #ifndef __MEM_CACHE_COMPRESSORS_BASE_DELTA_IMPL_HH__
 #define __MEM_CACHE_COMPRESSORS_BASE_DELTA_IMPL_HH__
 
+#include "base/intmath.hh"
 #include "debug/CacheComp.hh"
 #include "mem/cache/compressors/base_delta.hh"
+#include "mem/cache/compressors/base_delta_kernels.hh"
 #include "mem/cache/compressors/dictionary_compressor_impl.hh"
 
 namespace gem5
@@ -70,6 +72,92 @@ BaseDelta<BaseType, DeltaSizeBits>::addToDictionary(DictionaryEntry data)
         DictionaryCompressor<BaseType>::numEntries++] = data;
 }
 
+template <class BaseType, std::size_t DeltaSizeBits>
+std::unique_ptr<Base::CompressionData>
+BaseDelta<BaseType, DeltaSizeBits>::compress(
+    const std::vector<Base::Chunk>& chunks)
+{
+    typedef typename DictionaryCompressor<BaseType>::CompData CompData;
+    typedef typename DictionaryCompressor<BaseType>::Pattern Pattern;
+
+    std::unique_ptr<Base::CompressionData> comp_data =
+        this->instantiateDictionaryCompData();
+    CompData* const comp_data_ptr = static_cast<CompData*>(comp_data.get());
+
+    // Reset dictionary, which leaves the zero base as its only entry
+    resetDictionary();
+
+    const std::size_t num_values = chunks.size();
+    lineValues.assign(chunks.begin(), chunks.end());
+    matchLocations.assign(num_values, -1);
+
+    // Values that have not matched a base yet, in words of
+    // MaxDeltaFitValues bits
+    const std::size_t num_words = divCeil(num_values, MaxDeltaFitValues);
+    std::vector<uint64_t> unmatched(num_words, ~uint64_t(0));
+    if (num_values % MaxDeltaFitValues) {
+        unmatched.back() = mask(num_values % MaxDeltaFitValues);
+    }
+
+    // Match the line against every base, in the order they are added. A
+    // value only tries the bases added before it, but all values before
+    // the first unmatched one already matched an older base, so matching
+    // the unmatched values against the newest base is enough.
+    int location = 0;
+    BaseType base = 0;
+    while (true) {
+        std::size_t first_unmatched = num_values;
+        for (std::size_t w = 0; w < num_words; w++) {
+            const std::size_t start = w * MaxDeltaFitValues;
+            uint64_t fit = unmatched[w] & deltaFitMask(
+                lineValues.data() + start,
+                std::min(MaxDeltaFitValues, num_values - start), base,
+                DeltaSizeBits);
+            unmatched[w] &= ~fit;
+            while (fit) {
+                matchLocations[start + ctz64(fit)] = location;
+                fit &= fit - 1;
+            }
+            if (unmatched[w] && first_unmatched == num_values) {
+                first_unmatched = start + ctz64(unmatched[w]);
+            }
+        }
+        if (first_unmatched == num_values) {
+            break;
+        }
+
+        // The first unmatched value becomes the next base
+        unmatched[first_unmatched / MaxDeltaFitValues] &=
+            ~(uint64_t(1) << (first_unmatched % MaxDeltaFitValues));
+        base = lineValues[first_unmatched];
+        location++;
+    }
+
+    // Instantiate the patterns in order, allocating the new bases
+    for (std::size_t i = 0; i < num_values; i++) {
+        const DictionaryEntry bytes =
+            DictionaryCompressor<BaseType>::toDictionaryEntry(lineValues[i]);
+        std::unique_ptr<Pattern> pattern;
+        if (matchLocations[i] < 0) {
+            pattern.reset(new PatternX(bytes, -1));
+        } else {
+            pattern.reset(new PatternM(bytes, matchLocations[i]));
+        }
+
+        this->dictionaryStats.patterns[pattern->getPatternNumber()]++;
+        if (pattern->shouldAllocate()) {
+            addToDictionary(bytes);
+        }
+
+        DPRINTF(CacheComp, "Compressed %016x to %s\n", lineValues[i],
+            pattern->print());
+        comp_data_ptr->addEntry(std::move(pattern));
+    }
+
+    // Return compressed line
+    return comp_data;
+}
+
 template <class BaseType, std::size_t DeltaSizeBits>
 std::unique_ptr<Base::CompressionData>
 BaseDelta<BaseType, DeltaSizeBits>::compress(
@@ -0,0 +1,321 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Kernels used by the base-delta-immediate compressors to match a whole
+ * cache line against a base at once.
+ *
+ * A value fits a base when their difference, as a signed integer of the
+ * width of the values, is within [-limit, limit], with limit being the
+ * largest value representable by a signed delta of the given number of
+ * bits. Adding the limit to the difference maps that range onto
+ * [0, 2 * limit], so every check is a subtraction, an addition and an
+ * unsigned comparison, which vectorize well. When the host compiler
+ * targets SSE2 the 16 and 32-bit kernels are vectorized, and the 64-bit
+ * kernel requires SSE4.2; AVX2 doubles the vector width of all of them.
+ * The scalar implementations are always available for reference.
+ */
+
+#ifndef __MEM_CACHE_COMPRESSORS_BASE_DELTA_KERNELS_HH__
+#define __MEM_CACHE_COMPRESSORS_BASE_DELTA_KERNELS_HH__
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__AVX2__) || defined(__SSE4_2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "base/bitfield.hh"
+#include "base/compiler.hh"
+
+namespace gem5
+{
+
+GEM5_DEPRECATED_NAMESPACE(Compressor, compression);
+namespace compression
+{
+
+/** Maximum number of values matched by a single kernel call. */
+constexpr std::size_t MaxDeltaFitValues = 64;
+
+/**
+ * Largest magnitude of a delta that fits in a signed container.
+ *
+ * @tparam T Unsigned type of the values.
+ * @param delta_bits Size of the container, in bits. 0 only fits equal
+ *        values.
+ * @return The limit, as an unsigned value of the width of T.
+ */
+template <typename T>
+constexpr T
+deltaLimit(unsigned delta_bits)
+{
+    static_assert(std::is_unsigned_v<T>, "Values must be unsigned");
+    return delta_bits ? T(mask(delta_bits - 1)) : T(0);
+}
+
+namespace scalar
+{
+
+/**
+ * Find which values fit a delta from a base.
+ *
+ * @param values The values.
+ * @param n Number of values; at most MaxDeltaFitValues.
+ * @param base The base.
+ * @param delta_bits Size of the delta container, in bits; smaller than
+ *        the width of the values.
+ * @return A mask with bit i set if values[i] fits.
+ */
+template <typename T>
+inline uint64_t
+deltaFitMask(const T *values, std::size_t n, T base, unsigned delta_bits)
+{
+    assert(n <= MaxDeltaFitValues);
+    assert(delta_bits < sizeof(T) * 8);
+    const T limit = deltaLimit<T>(delta_bits);
+    const T range = T(2 * limit);
+    uint64_t fit = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        if (T(values[i] - base + limit) <= range) {
+            fit |= uint64_t(1) << i;
+        }
+    }
+    return fit;
+}
+
+} // namespace scalar
+
+#if defined(__AVX2__) || defined(__SSE2__)
+
+namespace simd
+{
+
+/**
+ * Vector operations on lanes of a given width. Unsigned comparisons are
+ * done by flipping the sign bit of both operands and comparing them as
+ * signed values.
+ *
+ * @tparam T Unsigned type of the lanes.
+ */
+template <typename T>
+struct Lanes
+{
+    static constexpr bool Vectorized = false;
+};
+
+#if defined(__AVX2__)
+
+typedef __m256i Vec;
+
+inline Vec vecLoad(const void *p)
+{ return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+inline Vec vecXor(Vec a, Vec b) { return _mm256_xor_si256(a, b); }
+
+template <>
+struct Lanes<uint16_t>
+{
+    static constexpr std::size_t PerVec = 16;
+    static constexpr bool Vectorized = true;
+    static Vec set1(uint16_t v) { return _mm256_set1_epi16(v); }
+    static Vec sub(Vec a, Vec b) { return _mm256_sub_epi16(a, b); }
+    static Vec add(Vec a, Vec b) { return _mm256_add_epi16(a, b); }
+    static Vec gt(Vec a, Vec b) { return _mm256_cmpgt_epi16(a, b); }
+    static uint64_t
+    moveMask(Vec m)
+    {
+        // Narrow every lane to a byte so that each yields a single bit.
+        // The packing works within each 128-bit half.
+        const uint32_t bits = _mm256_movemask_epi8(
+            _mm256_packs_epi16(m, _mm256_setzero_si256()));
+        return (bits & 0xff) | ((bits >> 8) & 0xff00);
+    }
+};
+
+template <>
+struct Lanes<uint32_t>
+{
+    static constexpr std::size_t PerVec = 8;
+    static constexpr bool Vectorized = true;
+    static Vec set1(uint32_t v) { return _mm256_set1_epi32(v); }
+    static Vec sub(Vec a, Vec b) { return _mm256_sub_epi32(a, b); }
+    static Vec add(Vec a, Vec b) { return _mm256_add_epi32(a, b); }
+    static Vec gt(Vec a, Vec b) { return _mm256_cmpgt_epi32(a, b); }
+    static uint64_t
+    moveMask(Vec m)
+    {
+        return _mm256_movemask_ps(_mm256_castsi256_ps(m));
+    }
+};
+
+template <>
+struct Lanes<uint64_t>
+{
+    static constexpr std::size_t PerVec = 4;
+    static constexpr bool Vectorized = true;
+    static Vec set1(uint64_t v) { return _mm256_set1_epi64x(v); }
+    static Vec sub(Vec a, Vec b) { return _mm256_sub_epi64(a, b); }
+    static Vec add(Vec a, Vec b) { return _mm256_add_epi64(a, b); }
+    static Vec gt(Vec a, Vec b) { return _mm256_cmpgt_epi64(a, b); }
+    static uint64_t
+    moveMask(Vec m)
+    {
+        return _mm256_movemask_pd(_mm256_castsi256_pd(m));
+    }
+};
+
+#else
+
+typedef __m128i Vec;
+
+inline Vec vecLoad(const void *p)
+{ return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+inline Vec vecXor(Vec a, Vec b) { return _mm_xor_si128(a, b); }
+
+template <>
+struct Lanes<uint16_t>
+{
+    static constexpr std::size_t PerVec = 8;
+    static constexpr bool Vectorized = true;
+    static Vec set1(uint16_t v) { return _mm_set1_epi16(v); }
+    static Vec sub(Vec a, Vec b) { return _mm_sub_epi16(a, b); }
+    static Vec add(Vec a, Vec b) { return _mm_add_epi16(a, b); }
+    static Vec gt(Vec a, Vec b) { return _mm_cmpgt_epi16(a, b); }
+    static uint64_t
+    moveMask(Vec m)
+    {
+        // Narrow every lane to a byte so that each yields a single bit
+        return _mm_movemask_epi8(_mm_packs_epi16(m, _mm_setzero_si128()));
+    }
+};
+
+template <>
+struct Lanes<uint32_t>
+{
+    static constexpr std::size_t PerVec = 4;
+    static constexpr bool Vectorized = true;
+    static Vec set1(uint32_t v) { return _mm_set1_epi32(v); }
+    static Vec sub(Vec a, Vec b) { return _mm_sub_epi32(a, b); }
+    static Vec add(Vec a, Vec b) { return _mm_add_epi32(a, b); }
+    static Vec gt(Vec a, Vec b) { return _mm_cmpgt_epi32(a, b); }
+    static uint64_t
+    moveMask(Vec m)
+    {
+        return _mm_movemask_ps(_mm_castsi128_ps(m));
+    }
+};
+
+template <>
+struct Lanes<uint64_t>
+{
+#if defined(__SSE4_2__)
+    static constexpr std::size_t PerVec = 2;
+    static constexpr bool Vectorized = true;
+    static Vec set1(uint64_t v) { return _mm_set1_epi64x(v); }
+    static Vec sub(Vec a, Vec b) { return _mm_sub_epi64(a, b); }
+    static Vec add(Vec a, Vec b) { return _mm_add_epi64(a, b); }
+    static Vec gt(Vec a, Vec b) { return _mm_cmpgt_epi64(a, b); }
+    static uint64_t
+    moveMask(Vec m)
+    {
+        return _mm_movemask_pd(_mm_castsi128_pd(m));
+    }
+#else
+    // SSE2 has no 64-bit comparison
+    static constexpr bool Vectorized = false;
+#endif
+};
+
+#endif // __AVX2__
+
+template <typename T>
+inline uint64_t
+deltaFitMask(const T *values, std::size_t n, T base, unsigned delta_bits)
+{
+    typedef Lanes<T> L;
+    assert(n <= MaxDeltaFitValues);
+    assert(delta_bits < sizeof(T) * 8);
+
+    const T sign_bit = T(1) << (sizeof(T) * 8 - 1);
+    const T limit = deltaLimit<T>(delta_bits);
+    const Vec vbase = L::set1(base);
+    const Vec vlimit = L::set1(limit);
+    const Vec vsign = L::set1(sign_bit);
+    const Vec vrange = L::set1(T(2 * limit) ^ sign_bit);
+
+    uint64_t fit = 0;
+    const std::size_t vec_end = n - n % L::PerVec;
+    for (std::size_t i = 0; i < vec_end; i += L::PerVec) {
+        const Vec biased = L::add(L::sub(vecLoad(values + i), vbase),
+                                  vlimit);
+        // Values whose biased delta exceeds the range do not fit
+        const Vec out = L::gt(vecXor(biased, vsign), vrange);
+        fit |= (~L::moveMask(out) & mask(L::PerVec)) << i;
+    }
+    if (vec_end < n) {
+        fit |= scalar::deltaFitMask(values + vec_end, n - vec_end, base,
+                                    delta_bits) << vec_end;
+    }
+    return fit;
+}
+
+} // namespace simd
+
+#endif // __AVX2__ || __SSE2__
+
+/**
+ * Find which values fit a delta from a base, using the vector kernel for
+ * the width of the values when the host has one.
+ *
+ * @param values The values.
+ * @param n Number of values; at most MaxDeltaFitValues.
+ * @param base The base.
+ * @param delta_bits Size of the delta container, in bits; smaller than
+ *        the width of the values.
+ * @return A mask with bit i set if values[i] fits.
+ */
+template <typename T>
+inline uint64_t
+deltaFitMask(const T *values, std::size_t n, T base, unsigned delta_bits)
+{
+#if defined(__AVX2__) || defined(__SSE2__)
+    if constexpr (simd::Lanes<T>::Vectorized) {
+        return simd::deltaFitMask(values, n, base, delta_bits);
+    }
+#endif
+    return scalar::deltaFitMask(values, n, base, delta_bits);
+}
+
+} // namespace compression
+} // namespace gem5
+
+#endif //__MEM_CACHE_COMPRESSORS_BASE_DELTA_KERNELS_HH__
@@ -0,0 +1,184 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "mem/cache/compressors/base_delta_kernels.hh"
+
+using namespace gem5;
+
+/** Whether a value fits a delta from a base, as BDI defines it. */
+template <typename T>
+static bool
+referenceFits(T value, T base, unsigned delta_bits)
+{
+    typedef std::make_signed_t<T> S;
+    const S limit = delta_bits ? S(mask(delta_bits - 1)) : 0;
+    const S delta = S(T(value - base));
+    return delta >= -limit && delta <= limit;
+}
+
+/**
+ * Draw values around a few bases, so that every delta size sees values
+ * that fit and values that do not, including values that wrap around.
+ */
+template <typename T>
+static std::vector<T>
+randomLine(std::mt19937_64 &gen, std::size_t n)
+{
+    const T base = gen();
+    std::vector<T> values(n);
+    for (auto &value : values) {
+        switch (gen() % 4) {
+          case 0: value = T(gen() & 0x3); break;
+          case 1: value = T(base + (gen() % 512) - 256); break;
+          case 2: value = T(gen()); break;
+          default: value = T(base + (gen() % 0x20000) - 0x10000); break;
+        }
+    }
+    return values;
+}
+
+template <typename T>
+static void
+checkKernel(unsigned seed)
+{
+    std::mt19937_64 gen(seed);
+    const unsigned width = sizeof(T) * 8;
+    for (std::size_t n = 1; n <= compression::MaxDeltaFitValues; n++) {
+        for (unsigned delta_bits = 0; delta_bits < width; delta_bits++) {
+            const std::vector<T> values = randomLine<T>(gen, n);
+            const T base = (gen() & 1) ? values[gen() % n] : T(0);
+
+            uint64_t expected = 0;
+            for (std::size_t i = 0; i < n; i++) {
+                if (referenceFits(values[i], base, delta_bits)) {
+                    expected |= uint64_t(1) << i;
+                }
+            }
+            ASSERT_EQ(compression::scalar::deltaFitMask(values.data(), n,
+                          base, delta_bits), expected);
+            ASSERT_EQ(compression::deltaFitMask(values.data(), n, base,
+                          delta_bits), expected);
+        }
+    }
+}
+
+TEST(BaseDeltaKernelsTest, DeltaFitMask16)
+{
+    checkKernel<uint16_t>(1);
+}
+
+TEST(BaseDeltaKernelsTest, DeltaFitMask32)
+{
+    checkKernel<uint32_t>(2);
+}
+
+TEST(BaseDeltaKernelsTest, DeltaFitMask64)
+{
+    checkKernel<uint64_t>(3);
+}
+
+TEST(BaseDeltaKernelsTest, Limits)
+{
+    // The range is symmetric: the most negative delta never fits
+    const uint16_t values[] = {0x007f, 0xff81, 0xff80, 0x0080, 0x0000};
+    ASSERT_EQ(compression::deltaFitMask(values, 5, uint16_t(0), 8),
+              uint64_t(0b10011));
+
+    // A zero-sized delta only fits equal values
+    const uint64_t qwords[] = {5, 4, 5, 6};
+    ASSERT_EQ(compression::deltaFitMask(qwords, 4, uint64_t(5), 0),
+              uint64_t(0b0101));
+}
+
+/**
+ * Time the classification of a 64-byte line against a base, as done by
+ * the BDI compressors for every base they try, with the scalar and the
+ * dispatched kernels. This is a micro-benchmark: it only reports the time
+ * per line, and fails only if the kernels disagree.
+ */
+template <typename T>
+static void
+benchmarkKernel(const char *name, unsigned delta_bits)
+{
+    constexpr std::size_t line_size = 64;
+    constexpr std::size_t num_values = line_size / sizeof(T);
+    constexpr std::size_t num_lines = 1024;
+    constexpr int num_rounds = 200;
+
+    std::mt19937_64 gen(4);
+    std::vector<T> lines;
+    std::vector<T> bases;
+    for (std::size_t l = 0; l < num_lines; l++) {
+        const std::vector<T> line = randomLine<T>(gen, num_values);
+        lines.insert(lines.end(), line.begin(), line.end());
+        bases.push_back(line[0]);
+    }
+
+    auto time_kernel = [&](auto kernel, uint64_t &checksum) {
+        const auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < num_rounds; r++) {
+            for (std::size_t l = 0; l < num_lines; l++) {
+                checksum += kernel(lines.data() + l * num_values,
+                                   num_values, bases[l], delta_bits);
+            }
+        }
+        const std::chrono::duration<double, std::nano> elapsed =
+            std::chrono::steady_clock::now() - start;
+        return elapsed.count() / (num_lines * num_rounds);
+    };
+
+    uint64_t scalar_sum = 0;
+    uint64_t simd_sum = 0;
+    const double scalar_ns = time_kernel(
+        compression::scalar::deltaFitMask<T>, scalar_sum);
+    const double simd_ns = time_kernel(
+        compression::deltaFitMask<T>, simd_sum);
+    ASSERT_EQ(scalar_sum, simd_sum);
+
+    std::printf("[ BENCH    ] %-13s scalar %6.2f ns/line, "
+                "dispatched %6.2f ns/line\n", name, scalar_ns, simd_ns);
+}
+
+TEST(BaseDeltaKernelsTest, Benchmark)
+{
+    benchmarkKernel<uint64_t>("Base64Delta8", 8);
+    benchmarkKernel<uint64_t>("Base64Delta32", 32);
+    benchmarkKernel<uint32_t>("Base32Delta8", 8);
+    benchmarkKernel<uint32_t>("Base32Delta16", 16);
+    benchmarkKernel<uint16_t>("Base16Delta8", 8);
+}
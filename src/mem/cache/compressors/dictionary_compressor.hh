@@ -168,6 +168,23 @@ class DictionaryCompressor : public BaseDictionaryCompressor
                                                     match_location);
             }
         }
+
+        /**
+         * Get the size of the pattern getPattern() would instantiate. The
+         * pattern is built on the stack, so that the candidates of a value
+         * can be compared without heap allocations.
+         */
+        static std::size_t
+        getPatternSizeBits(const DictionaryEntry& bytes,
+            const DictionaryEntry& dict_bytes, const int match_location)
+        {
+            if (Head::isPattern(bytes, dict_bytes, match_location)) {
+                return Head(bytes, match_location).getSizeBits();
+            } else {
+                return Factory<Tail...>::getPatternSizeBits(bytes,
+                    dict_bytes, match_location);
+            }
+        }
     };
 
     /**
@@ -189,6 +206,13 @@ class DictionaryCompressor : public BaseDictionaryCompressor
         {
             return std::unique_ptr<Pattern>(new Head(bytes, match_location));
         }
+
+        static std::size_t
+        getPatternSizeBits(const DictionaryEntry& bytes,
+            const DictionaryEntry& dict_bytes, const int match_location)
+        {
+            return Head(bytes, match_location).getSizeBits();
+        }
     };
 
     /** The dictionary. */
@@ -203,6 +227,51 @@ class DictionaryCompressor : public BaseDictionaryCompressor
     getPattern(const DictionaryEntry& bytes, const DictionaryEntry& dict_bytes,
         const int match_location) const = 0;
 
+    /**
+     * Get the size of the pattern getPattern() would return. Classes that
+     * use a factory should implement it with their factory's
+     * getPatternSizeBits, which does not allocate the pattern.
+     */
+    virtual std::size_t
+    getPatternSizeBits(const DictionaryEntry& bytes,
+        const DictionaryEntry& dict_bytes, const int match_location) const
+    {
+        return getPattern(bytes, dict_bytes, match_location)->getSizeBits();
+    }
+
+    /**
+     * Find the dictionary entry that matches a value with the smallest
+     * pattern. Only the sizes of the candidates are computed, so no
+     * pattern is allocated. On a tie, the earliest candidate wins, and the
+     * no-match pattern is tried first.
+     *
+     * @param bytes The value, as a dictionary entry.
+     * @param dictionary The dictionary.
+     * @param num_entries The number of valid entries of the dictionary.
+     * @param size_bits Callable giving the size of the pattern of the
+     *        value for a dictionary entry and its location.
+     * @return The location of the best entry, or -1 for no match.
+     */
+    template <class SizeBits>
+    static int
+    findBestMatch(const DictionaryEntry& bytes,
+        const std::vector<DictionaryEntry>& dictionary,
+        std::size_t num_entries, SizeBits size_bits)
+    {
+        // A negative match location is used so that patterns that depend
+        // on the dictionary entry don't match
+        std::size_t best_size = size_bits(bytes, toDictionaryEntry(0), -1);
+        int best_location = -1;
+        for (std::size_t i = 0; i < num_entries; i++) {
+            const std::size_t size = size_bits(bytes, dictionary[i], i);
+            if (size < best_size) {
+                best_size = size;
+                best_location = i;
+            }
+        }
+        return best_location;
+    }
+
     /**
      * Compress data.
      *
@@ -243,7 +312,7 @@ class DictionaryCompressor : public BaseDictionaryCompressor
      * @param chunks The cache line to be compressed.
      * @return Cache line after compression.
      */
-    std::unique_ptr<Base::CompressionData> compress(
+    virtual std::unique_ptr<Base::CompressionData> compress(
         const std::vector<Chunk>& chunks);
 
     std::unique_ptr<Base::CompressionData> compress(
@@ -0,0 +1,259 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "mem/cache/compressors/cpack.hh"
+#include "mem/cache/compressors/dictionary_compressor_impl.hh"
+#include "mem/cache/compressors/fpc.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/**
+ * Exposes the pattern factory of a compressor, so that the selection of
+ * the patterns can be checked without instantiating the compressor.
+ */
+template <class Compressor>
+class PatternSelector : public Compressor
+{
+  public:
+    using typename Compressor::DictionaryEntry;
+    using typename Compressor::Pattern;
+    using typename Compressor::PatternFactory;
+    using Compressor::toDictionaryEntry;
+
+    /**
+     * Select the pattern of a value as compressValue() does: only the
+     * sizes of the candidates are compared, and the winner is built.
+     */
+    static std::unique_ptr<Pattern>
+    select(const DictionaryEntry& bytes,
+        const std::vector<DictionaryEntry>& dictionary,
+        std::size_t num_entries)
+    {
+        const int location = Compressor::findBestMatch(bytes, dictionary,
+            num_entries, PatternFactory::getPatternSizeBits);
+        return (location < 0) ?
+            PatternFactory::getPattern(bytes, toDictionaryEntry(0), -1) :
+            PatternFactory::getPattern(bytes, dictionary[location],
+                                       location);
+    }
+
+    /**
+     * Select the pattern of a value as compressValue() used to: every
+     * candidate is built, and replaces the best one if it is smaller.
+     */
+    static std::unique_ptr<Pattern>
+    reference(const DictionaryEntry& bytes,
+        const std::vector<DictionaryEntry>& dictionary,
+        std::size_t num_entries)
+    {
+        std::unique_ptr<Pattern> pattern =
+            PatternFactory::getPattern(bytes, toDictionaryEntry(0), -1);
+        for (std::size_t i = 0; i < num_entries; i++) {
+            std::unique_ptr<Pattern> temp_pattern =
+                PatternFactory::getPattern(bytes, dictionary[i], i);
+            if (temp_pattern->getSizeBits() < pattern->getSizeBits()) {
+                pattern = std::move(temp_pattern);
+            }
+        }
+        return pattern;
+    }
+};
+
+using CPackSelector = PatternSelector<compression::CPack>;
+using FPCSelector = PatternSelector<compression::FPC>;
+
+/** Number of 32-bit values in a 64-byte line. */
+constexpr std::size_t numValues = 16;
+
+/**
+ * Draw lines whose values match every pattern of C-Pack and FPC: zeros,
+ * small signed values, halfwords, repeated bytes, and values that repeat
+ * an earlier value of the line in full or in their upper bytes.
+ */
+std::vector<uint32_t>
+randomLines(std::mt19937 &gen, std::size_t num_lines)
+{
+    std::vector<uint32_t> values;
+    for (std::size_t l = 0; l < num_lines; l++) {
+        const std::size_t line_start = values.size();
+        for (std::size_t i = 0; i < numValues; i++) {
+            const uint32_t random = gen();
+            const uint32_t earlier = (i == 0) ? random :
+                values[line_start + gen() % i];
+            switch (gen() % 10) {
+              case 0: values.push_back(0); break;
+              case 1: values.push_back(int32_t(int8_t(random))); break;
+              case 2: values.push_back(int32_t(int16_t(random))); break;
+              case 3: values.push_back(random << 16); break;
+              case 4: values.push_back((random & 0xff) * 0x01010101); break;
+              case 5: values.push_back(earlier); break;
+              case 6:
+                values.push_back((earlier & 0xffffff00) | (random & 0xff));
+                break;
+              case 7:
+                values.push_back((earlier & 0xffff0000) |
+                                 (random & 0xffff));
+                break;
+              default: values.push_back(random); break;
+            }
+        }
+    }
+    return values;
+}
+
+/**
+ * Compress the lines with a selection function, filling the dictionary as
+ * the compressors do, and pass every pattern to a callback.
+ */
+template <class Selector, class Select, class Callback>
+void
+compressLines(const std::vector<uint32_t>& values,
+    std::size_t dictionary_size, Select select, Callback callback)
+{
+    std::vector<typename Selector::DictionaryEntry> dictionary(
+        dictionary_size);
+    for (std::size_t line = 0; line < values.size(); line += numValues) {
+        std::size_t num_entries = 0;
+        for (std::size_t i = line; i < line + numValues; i++) {
+            const auto bytes = Selector::toDictionaryEntry(values[i]);
+            auto pattern = select(bytes, dictionary, num_entries);
+            if (pattern->shouldAllocate() &&
+                num_entries < dictionary_size) {
+                dictionary[num_entries++] = bytes;
+            }
+            callback(i, *pattern);
+        }
+    }
+}
+
+/**
+ * Check that the patterns selected by comparing sizes are the ones that
+ * the former selection, which built every candidate, picked.
+ */
+template <class Selector>
+void
+checkSelection(std::size_t dictionary_size)
+{
+    std::mt19937 gen(7);
+    const std::vector<uint32_t> values = randomLines(gen, 512);
+
+    std::vector<int> numbers;
+    std::vector<std::size_t> sizes;
+    std::vector<int> locations;
+    compressLines<Selector>(values, dictionary_size, Selector::reference,
+        [&](std::size_t i, const typename Selector::Pattern& pattern) {
+            numbers.push_back(pattern.getPatternNumber());
+            sizes.push_back(pattern.getSizeBits());
+            locations.push_back(pattern.getMatchLocation());
+        });
+
+    std::vector<bool> seen(numbers.size(), false);
+    compressLines<Selector>(values, dictionary_size, Selector::select,
+        [&](std::size_t i, const typename Selector::Pattern& pattern) {
+            ASSERT_EQ(pattern.getPatternNumber(), numbers[i]) << i;
+            ASSERT_EQ(pattern.getSizeBits(), sizes[i]) << i;
+            ASSERT_EQ(pattern.getMatchLocation(), locations[i]) << i;
+            seen[i] = true;
+        });
+    for (std::size_t i = 0; i < seen.size(); i++) {
+        ASSERT_TRUE(seen[i]) << i;
+    }
+}
+
+} // anonymous namespace
+
+TEST(DictionaryCompressorTest, CPackSelection)
+{
+    checkSelection<CPackSelector>(numValues);
+}
+
+TEST(DictionaryCompressorTest, FPCSelection)
+{
+    checkSelection<FPCSelector>(1);
+}
+
+/**
+ * Time the compression of a 64-byte line, value by value, with the
+ * current and the former pattern selection. This is a micro-benchmark:
+ * it only reports the time per line, and fails only if the selections
+ * disagree on the size of the lines.
+ */
+template <class Selector>
+static void
+benchmarkSelection(const char *name, std::size_t dictionary_size)
+{
+    constexpr std::size_t num_lines = 1024;
+    constexpr int num_rounds = 50;
+
+    std::mt19937 gen(8);
+    const std::vector<uint32_t> values = randomLines(gen, num_lines);
+
+    auto time_selection = [&](auto select, uint64_t &total_bits) {
+        const auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < num_rounds; r++) {
+            compressLines<Selector>(values, dictionary_size, select,
+                [&](std::size_t i,
+                    const typename Selector::Pattern& pattern) {
+                    total_bits += pattern.getSizeBits();
+                });
+        }
+        const std::chrono::duration<double, std::nano> elapsed =
+            std::chrono::steady_clock::now() - start;
+        return elapsed.count() / (num_lines * num_rounds);
+    };
+
+    uint64_t reference_bits = 0;
+    uint64_t select_bits = 0;
+    const double reference_ns = time_selection(Selector::reference,
+                                               reference_bits);
+    const double select_ns = time_selection(Selector::select, select_bits);
+    ASSERT_EQ(reference_bits, select_bits);
+
+    std::printf("[ BENCH    ] %-13s all candidates %7.2f ns/line, "
+                "sizes only %7.2f ns/line\n", name, reference_ns,
+                select_ns);
+}
+
+TEST(DictionaryCompressorTest, Benchmark)
+{
+    benchmarkSelection<CPackSelector>("CPack", numValues);
+    benchmarkSelection<FPCSelector>("FPC", 1);
+}
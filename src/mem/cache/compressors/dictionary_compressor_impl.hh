@@ -98,22 +98,17 @@ DictionaryCompressor<T>::compressValue(const T data)
     // Split data in bytes
     const DictionaryEntry bytes = toDictionaryEntry(data);
 
-    // Start as a no-match pattern. A negative match location is used so that
-    // patterns that depend on the dictionary entry don't match
-    std::unique_ptr<Pattern> pattern =
-        getPattern(bytes, toDictionaryEntry(0), -1);
-
-    // Search for word on dictionary
-    for (std::size_t i = 0; i < numEntries; i++) {
-        // Try matching input with possible patterns
-        std::unique_ptr<Pattern> temp_pattern =
-            getPattern(bytes, dictionary[i], i);
-
-        // Check if found pattern is better than previous
-        if (temp_pattern->getSizeBits() < pattern->getSizeBits()) {
-            pattern = std::move(temp_pattern);
-        }
-    }
+    // Search for word on dictionary. Only the sizes of the candidates are
+    // needed to pick the best one, so only the winner is instantiated
+    const int best_location = findBestMatch(bytes, dictionary, numEntries,
+        [this](const DictionaryEntry& value,
+               const DictionaryEntry& dict_bytes, const int match_location)
+        {
+            return getPatternSizeBits(value, dict_bytes, match_location);
+        });
+    std::unique_ptr<Pattern> pattern = (best_location < 0) ?
+        getPattern(bytes, toDictionaryEntry(0), -1) :
+        getPattern(bytes, dictionary[best_location], best_location);
 
     // Update stats
     dictionaryStats.patterns[pattern->getPatternNumber()]++;
@@ -57,7 +57,7 @@ namespace compression
 
 class FPC : public DictionaryCompressor<uint32_t>
 {
-  private:
+  protected:
     using DictionaryEntry = DictionaryCompressor<uint32_t>::DictionaryEntry;
 
     /**
@@ -94,6 +94,14 @@ class FPC : public DictionaryCompressor<uint32_t>
      */
     const int zeroRunSizeBits;
 
+    /**
+     * Convenience factory declaration. The templates must be organized by
+     * size, with the smallest first, and "no-match" last.
+     */
+    using PatternFactory = Factory<ZeroRun, SignExtended4Bits,
+        SignExtended1Byte, SignExtendedHalfword, ZeroPaddedHalfword,
+        SignExtendedTwoHalfwords, RepBytes, Uncompressed>;
+
     uint64_t getNumPatterns() const override { return NUM_PATTERNS; }
 
     std::string
@@ -118,12 +126,18 @@ class FPC : public DictionaryCompressor<uint32_t>
         const DictionaryEntry& dict_bytes,
         const int match_location) const override
     {
-        using PatternFactory = Factory<ZeroRun, SignExtended4Bits,
-            SignExtended1Byte, SignExtendedHalfword, ZeroPaddedHalfword,
-            SignExtendedTwoHalfwords, RepBytes, Uncompressed>;
         return PatternFactory::getPattern(bytes, dict_bytes, match_location);
     }
 
+    std::size_t
+    getPatternSizeBits(const DictionaryEntry& bytes,
+        const DictionaryEntry& dict_bytes,
+        const int match_location) const override
+    {
+        return PatternFactory::getPatternSizeBits(bytes, dict_bytes,
+                                                  match_location);
+    }
+
     void addToDictionary(const DictionaryEntry data) override;
 
     std::unique_ptr<DictionaryCompressor::CompData>
@@ -177,6 +177,9 @@ class FrequentValues : public Base
 
     void decompress(const CompressionData* comp_data, uint64_t* data) override;
 
+    /** The codes of the values depend on the values previously sampled. */
+    bool dependsOnHistory() const override { return true; }
+
   public:
     typedef FrequentValuesCompressorParams Params;
     FrequentValues(const Params &p);
@@ -87,6 +87,17 @@ Multi::setCache(BaseCache *_cache)
     }
 }
 
+bool
+Multi::dependsOnHistory() const
+{
+    for (const auto& compressor : compressors) {
+        if (compressor->dependsOnHistory()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 std::unique_ptr<Base::CompressionData>
 Multi::compress(const std::vector<Chunk>& chunks, Cycles& comp_lat,
     Cycles& decomp_lat)
@@ -101,6 +101,8 @@ class Multi : public Base
         statistics::Vector2d ranks;
     } multiStats;
 
+    bool dependsOnHistory() const override;
+
   public:
     typedef MultiCompressorParams Params;
     Multi(const Params &p);
@@ -59,6 +59,10 @@
 namespace gem5
 {
 
+// A node of a target list holds a target and the links to its neighbours
+FreeListPool mshrTargetPool("mshrTarget",
+                            sizeof(MSHR::Target) + 2 * sizeof(void *));
+
 MSHR::MSHR(const std::string &name)
     :   QueueEntry(name),
         downstreamPending(false),
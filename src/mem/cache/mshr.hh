@@ -52,6 +52,7 @@
 #include <string>
 #include <vector>
 
+#include "base/free_list_pool.hh"
 #include "base/printable.hh"
 #include "base/trace.hh"
 #include "base/types.hh"
@@ -66,6 +67,9 @@ namespace gem5
 
 class BaseCache;
 
+/** Pool the nodes of the MSHR target lists are allocated from. */
+extern FreeListPool mshrTargetPool;
+
 /**
  * Miss Status and handling Register. This class keeps all the information
  * needed to handle a cache miss including a list of target requests.
@@ -166,7 +170,10 @@ class MSHR : public QueueEntry, public Printable
         {}
     };
 
-    class TargetList : public std::list<Target>, public Named
+    class TargetList
+        : public std::list<Target,
+                           FreeListPoolAllocator<Target, mshrTargetPool>>,
+          public Named
     {
 
       public:
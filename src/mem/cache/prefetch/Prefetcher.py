@@ -83,6 +83,12 @@ class BasePrefetcher(ClockedObject):
         "Use virtual addresses for prefetching")
     page_bytes = Param.MemorySize('4KiB',
             "Size of pages for virtual addresses")
+    pc_stats_entries = Param.Unsigned(0, "Number of PCs whose prefetches "
+        "are accounted in the per-PC stats, which list the PCs issuing the "
+        "most prefetches (0 to disable)")
+    pc_stats_blocks = Param.Unsigned(4096, "Number of prefetched blocks "
+        "whose PC is tracked at once by the per-PC stats. Prefetches of "
+        "untracked blocks are only accounted as issued")
 
     def __init__(self, **kwargs):
         super().__init__(**kwargs)
@@ -120,6 +126,41 @@ class MultiPrefetcher(BasePrefetcher):
 
     prefetchers = VectorParam.BasePrefetcher([], "Array of prefetchers")
 
+class PrefetchFeedbackController(SimObject):
+    type = 'PrefetchFeedbackController'
+    cxx_class = 'gem5::prefetch::FeedbackController'
+    cxx_header = "mem/cache/prefetch/feedback_controller.hh"
+
+    interval = Param.Unsigned(8192,
+        "Number of accesses observed by the prefetcher per interval")
+
+    # The default levels are the ones of the stream prefetcher of the
+    # original proposal, from the least to the most aggressive
+    degrees = VectorParam.Unsigned([1, 1, 2, 4, 4],
+        "Number of prefetches generated per access at every level")
+    distances = VectorParam.Unsigned([4, 8, 16, 32, 64],
+        "How many prefetches ahead of the access to prefetch at every level")
+    start_level = Param.Unsigned(2, "Index of the starting level")
+
+    accuracy_high = Param.Float(0.75,
+        "Accuracy above which the prefetcher is considered accurate")
+    accuracy_low = Param.Float(0.40,
+        "Accuracy below which the prefetcher is considered inaccurate")
+    lateness_threshold = Param.Float(0.01,
+        "Fraction of useful prefetches that are late above which the "
+        "prefetcher is considered late")
+    pollution_threshold = Param.Float(0.005,
+        "Fraction of demand misses caused by prefetches above which the "
+        "prefetcher is considered polluting")
+    pollution_filter_entries = Param.Unsigned(4096,
+        "Number of entries of the filter of blocks evicted by prefetches")
+
+    mem_ctrl = Param.MemCtrl(NULL, "Memory controller whose read queue "
+        "occupancy throttles the prefetcher")
+    bandwidth_threshold = Param.Float(0.75,
+        "Average read queue occupancy above which the prefetcher is "
+        "throttled down")
+
 class QueuedPrefetcher(BasePrefetcher):
     type = "QueuedPrefetcher"
     abstract = True
@@ -147,6 +188,9 @@ class QueuedPrefetcher(BasePrefetcher):
     throttle_control_percentage = Param.Percent(0, "Percentage of requests \
         that can be throttled depending on the accuracy of the prefetcher.")
 
+    feedback = Param.PrefetchFeedbackController(NULL,
+        "Controller adjusting the degree and distance of the prefetcher")
+
 class StridePrefetcherHashedSetAssociative(SetAssociative):
     type = 'StridePrefetcherHashedSetAssociative'
     cxx_class = 'gem5::prefetch::StridePrefetcherHashedSetAssociative'
@@ -493,6 +537,85 @@ class STeMSPrefetcher(QueuedPrefetcher):
     reconstruction_entries = Param.Unsigned(256,
         "Number of reconstruction entries")
 
+class BertiPrefetcher(QueuedPrefetcher):
+    type = "BertiPrefetcher"
+    cxx_class = 'gem5::prefetch::Berti'
+    cxx_header = "mem/cache/prefetch/berti.hh"
+
+    # Berti is meant to be used as an L1D prefetcher. It also learns from
+    # the hits on prefetched blocks, which are only notified if the cache
+    # prefetches on them (prefetch_on_pf_hit or prefetch_on_access)
+    on_inst = False
+
+    table_entries = Param.MemorySize("64",
+        "Number of entries of the PC table")
+    table_assoc = Param.Unsigned(16, "Associativity of the PC table")
+    table_indexing_policy = Param.BaseIndexingPolicy(
+        SetAssociative(entry_size = 1, assoc = Parent.table_assoc,
+        size = Parent.table_entries),
+        "Indexing policy of the PC table")
+    table_replacement_policy = Param.BaseReplacementPolicy(LRURP(),
+        "Replacement policy of the PC table")
+
+    history_length = Param.Unsigned(16,
+        "Number of recent accesses of a PC searched for timely deltas")
+    num_deltas = Param.Unsigned(16,
+        "Number of deltas of a PC whose coverage is tracked")
+    search_interval = Param.Unsigned(16,
+        "Number of searches for timely deltas between coverage updates")
+    high_coverage_threshold = Param.Percent(65,
+        "Coverage of the deltas prefetched with a priority of 1, the other "
+        "ones get 0. A replacement policy with a prefetch priority "
+        "threshold of 1 inserts the latter close to eviction")
+    low_coverage_threshold = Param.Percent(35,
+        "Coverage below which deltas are not prefetched")
+    max_delta = Param.Unsigned(4096, "Maximum absolute delta, in blocks")
+
+    in_flight_entries = Param.Unsigned(64,
+        "Number of outstanding misses and prefetches whose fetch latency "
+        "is measured")
+    latency_entries = Param.Unsigned(1024,
+        "Number of unused prefetched blocks whose fetch latency is kept")
+
+class BingoPrefetcher(QueuedPrefetcher):
+    type = "BingoPrefetcher"
+    cxx_class = 'gem5::prefetch::Bingo'
+    cxx_header = "mem/cache/prefetch/bingo.hh"
+
+    # Bingo learns the footprints from every access, so the cache should
+    # be configured to notify hits too (prefetch_on_access)
+    on_inst = False
+
+    region_size = Param.MemorySize("2KiB", "Size of a spatial region")
+    vote_threshold = Param.Percent(20,
+        "Percentage of the footprints of the same PC and offset that must "
+        "contain a block to prefetch it, when the trigger address has no "
+        "footprint")
+
+    accumulation_table_entries = Param.MemorySize("64",
+        "Number of entries of the accumulation table")
+    accumulation_table_assoc = Param.Unsigned(64,
+        "Associativity of the accumulation table")
+    accumulation_table_indexing_policy = Param.BaseIndexingPolicy(
+        SetAssociative(entry_size = 1,
+            assoc = Parent.accumulation_table_assoc,
+            size = Parent.accumulation_table_entries),
+        "Indexing policy of the accumulation table")
+    accumulation_table_replacement_policy = Param.BaseReplacementPolicy(
+        LRURP(), "Replacement policy of the accumulation table")
+
+    pattern_history_table_entries = Param.MemorySize("16384",
+        "Number of entries of the pattern history table")
+    pattern_history_table_assoc = Param.Unsigned(16,
+        "Associativity of the pattern history table")
+    pattern_history_table_indexing_policy = Param.BaseIndexingPolicy(
+        SetAssociative(entry_size = 1,
+            assoc = Parent.pattern_history_table_assoc,
+            size = Parent.pattern_history_table_entries),
+        "Indexing policy of the pattern history table")
+    pattern_history_table_replacement_policy = Param.BaseReplacementPolicy(
+        LRURP(), "Replacement policy of the pattern history table")
+
 class HWPProbeEventRetiredInsts(HWPProbeEvent):
     def register(self):
         if self.obj:
@@ -29,6 +29,10 @@
 #ifndef __CACHE_PREFETCH_ASSOCIATIVE_SET_HH__
 #define __CACHE_PREFETCH_ASSOCIATIVE_SET_HH__
 
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
 #include "mem/cache/replacement_policies/base.hh"
 #include "mem/cache/tags/indexing_policies/base.hh"
 #include "mem/cache/tags/tagged_entry.hh"
@@ -61,8 +65,70 @@ class AssociativeSet
     replacement_policy::Base* const replacementPolicy;
     /** Vector containing the entries of the container */
     std::vector<Entry> entries;
+    /** Buffer the indexing policy may write the possible entries to */
+    mutable std::vector<ReplaceableEntry*> possibleEntries;
 
   public:
+    /**
+     * View over the entries that could be replaced given a key, which
+     * presents them as entries of the container without copying them. It
+     * refers to a buffer of the container, so it is only valid until the
+     * next lookup in the container.
+     */
+    class PossibleEntries
+    {
+      private:
+        using BaseIterator =
+            typename std::vector<ReplaceableEntry *>::const_iterator;
+
+        const std::vector<ReplaceableEntry *> &entries;
+
+      public:
+        class iterator
+        {
+          private:
+            BaseIterator it;
+
+          public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = Entry *;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Entry * const *;
+            using reference = Entry *;
+
+            explicit iterator(BaseIterator _it) : it(_it) {}
+
+            Entry *operator*() const { return static_cast<Entry *>(*it); }
+
+            iterator &
+            operator++()
+            {
+                ++it;
+                return *this;
+            }
+
+            bool
+            operator==(const iterator &other) const
+            {
+                return it == other.it;
+            }
+
+            bool
+            operator!=(const iterator &other) const
+            {
+                return it != other.it;
+            }
+        };
+
+        PossibleEntries(const std::vector<ReplaceableEntry *> &_entries)
+          : entries(_entries)
+        {}
+
+        iterator begin() const { return iterator(entries.begin()); }
+        iterator end() const { return iterator(entries.end()); }
+        std::size_t size() const { return entries.size(); }
+    };
+
     /**
      * Public constructor
      * @param assoc number of elements in each associative set
@@ -102,9 +168,9 @@ class AssociativeSet
      * Find the set of entries that could be replaced given
      * that we want to add a new entry with the provided key
      * @param addr key to select the set of entries
-     * @result vector of candidates matching with the provided key
+     * @result view over the candidates matching with the provided key
      */
-    std::vector<Entry *> getPossibleEntries(const Addr addr) const;
+    PossibleEntries getPossibleEntries(const Addr addr) const;
 
     /**
      * Indicate that an entry has just been inserted
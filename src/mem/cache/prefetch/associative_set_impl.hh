@@ -46,10 +46,12 @@ AssociativeSet<Entry>::AssociativeSet(int assoc, int num_entries,
              "AssociativeSet<> must be a power of 2");
     fatal_if(!isPowerOf2(assoc), "The associativity of an AssociativeSet<> "
              "must be a power of 2");
+    const auto replacement_data = replacementPolicy->instantiateEntries(
+        numEntries / associativity, associativity);
     for (unsigned int entry_idx = 0; entry_idx < numEntries; entry_idx += 1) {
         Entry* entry = &entries[entry_idx];
         indexingPolicy->setEntry(entry, entry_idx);
-        entry->replacementData = replacementPolicy->instantiateEntry();
+        entry->replacementData = replacement_data[entry_idx];
     }
 }
 
@@ -58,8 +60,8 @@ Entry*
 AssociativeSet<Entry>::findEntry(Addr addr, bool is_secure) const
 {
     Addr tag = indexingPolicy->extractTag(addr);
-    const std::vector<ReplaceableEntry*> selected_entries =
-        indexingPolicy->getPossibleEntries(addr);
+    const std::vector<ReplaceableEntry*>& selected_entries =
+        indexingPolicy->getPossibleEntries(addr, possibleEntries);
 
     for (const auto& location : selected_entries) {
         Entry* entry = static_cast<Entry *>(location);
@@ -83,8 +85,8 @@ Entry*
 AssociativeSet<Entry>::findVictim(Addr addr)
 {
     // Get possible entries to be victimized
-    const std::vector<ReplaceableEntry*> selected_entries =
-        indexingPolicy->getPossibleEntries(addr);
+    const std::vector<ReplaceableEntry*>& selected_entries =
+        indexingPolicy->getPossibleEntries(addr, possibleEntries);
     Entry* victim = static_cast<Entry*>(replacementPolicy->getVictim(
                             selected_entries));
     // There is only one eviction for this replacement
@@ -94,18 +96,11 @@ AssociativeSet<Entry>::findVictim(Addr addr)
 
 
 template<class Entry>
-std::vector<Entry *>
+typename AssociativeSet<Entry>::PossibleEntries
 AssociativeSet<Entry>::getPossibleEntries(const Addr addr) const
 {
-    std::vector<ReplaceableEntry *> selected_entries =
-        indexingPolicy->getPossibleEntries(addr);
-    std::vector<Entry *> entries(selected_entries.size(), nullptr);
-
-    unsigned int idx = 0;
-    for (auto &entry : selected_entries) {
-        entries[idx++] = static_cast<Entry *>(entry);
-    }
-    return entries;
+    return PossibleEntries(
+        indexingPolicy->getPossibleEntries(addr, possibleEntries));
 }
 
 template<class Entry>
@@ -102,8 +102,11 @@ Base::Base(const BasePrefetcherParams &p)
       prefetchOnAccess(p.prefetch_on_access),
       prefetchOnPfHit(p.prefetch_on_pf_hit),
       useVirtualAddresses(p.use_virtual_addresses),
-      prefetchStats(this), issuedPrefetches(0),
-      usefulPrefetches(0), tlb(nullptr)
+      prefetchStats(this),
+      pcStats(p.pc_stats_entries ? new PCStats(this, p.pc_stats_entries,
+                                               p.pc_stats_blocks) : nullptr),
+      issuedPrefetches(0), usefulPrefetches(0), latePrefetches(0),
+      tlb(nullptr)
 {
 }
 
@@ -142,7 +145,12 @@ Base::StatGroup::StatGroup(statistics::Group *parent)
     ADD_STAT(pfHitInWB, statistics::units::Count::get(),
         "number of prefetches hit in the Write Buffer"),
     ADD_STAT(pfLate, statistics::units::Count::get(),
-        "number of late prefetches (hitting in cache, MSHR or WB)")
+        "number of late prefetches (hitting in cache, MSHR or WB)"),
+    ADD_STAT(pfLateUseful, statistics::units::Count::get(),
+        "number of prefetches still in flight when a demand requested them"),
+    ADD_STAT(pfCovered, statistics::units::Count::get(),
+        "number of demand misses covered, fully or partially, by "
+        "prefetches")
 {
     using namespace statistics;
 
@@ -155,6 +163,8 @@ Base::StatGroup::StatGroup(statistics::Group *parent)
     coverage = pfUseful / (pfUseful + demandMshrMisses);
 
     pfLate = pfHitInCache + pfHitInMSHR + pfHitInWB;
+
+    pfCovered = pfUseful + pfLateUseful;
 }
 
 bool
@@ -203,6 +213,69 @@ Base::hasBeenPrefetched(Addr addr, bool is_secure) const
     return cache->hasBeenPrefetched(addr, is_secure);
 }
 
+bool
+Base::hasBeenPrefetched(Addr addr, bool is_secure,
+                        RequestorID requestor) const
+{
+    return cache->hasBeenPrefetched(addr, is_secure, requestor);
+}
+
+void
+Base::prefetchUnused(Addr addr, bool is_secure, RequestorID requestor)
+{
+    accountEvent(requestor, [&](Base &pf) {
+        pf.prefetchStats.pfUnused++;
+        if (pf.pcStats) {
+            pf.pcStats->prefetchUnused(addr, is_secure);
+        }
+    });
+}
+
+void
+Base::prefetchLate(const PacketPtr &pf_pkt)
+{
+    accountEvent(pf_pkt->req->requestorId(), [&](Base &pf) {
+        pf.prefetchStats.pfLateUseful++;
+        pf.latePrefetches += 1;
+        if (pf.pcStats) {
+            pf.pcStats->prefetchLate(pf_pkt->getAddr(), pf_pkt->isSecure());
+        }
+    });
+}
+
+void
+Base::pfHitInCache(const PacketPtr &pkt)
+{
+    accountEvent(pkt->req->requestorId(), [&](Base &pf) {
+        pf.prefetchStats.pfHitInCache++;
+        if (pf.pcStats) {
+            pf.pcStats->prefetchDropped(pkt->getAddr(), pkt->isSecure());
+        }
+    });
+}
+
+void
+Base::pfHitInMSHR(const PacketPtr &pkt)
+{
+    accountEvent(pkt->req->requestorId(), [&](Base &pf) {
+        pf.prefetchStats.pfHitInMSHR++;
+        if (pf.pcStats) {
+            pf.pcStats->prefetchDropped(pkt->getAddr(), pkt->isSecure());
+        }
+    });
+}
+
+void
+Base::pfHitInWB(const PacketPtr &pkt)
+{
+    accountEvent(pkt->req->requestorId(), [&](Base &pf) {
+        pf.prefetchStats.pfHitInWB++;
+        if (pf.pcStats) {
+            pf.pcStats->prefetchDropped(pkt->getAddr(), pkt->isSecure());
+        }
+    });
+}
+
 bool
 Base::samePage(Addr a, Addr b) const
 {
@@ -251,13 +324,28 @@ Base::probeNotify(const PacketPtr &pkt, bool miss)
         panic("Request must have a physical address");
     }
 
-    if (hasBeenPrefetched(pkt->getAddr(), pkt->isSecure())) {
-        usefulPrefetches += 1;
-        prefetchStats.pfUseful++;
-        if (miss)
-            // This case happens when a demand hits on a prefetched line
-            // that's not in the requested coherency state.
-            prefetchStats.pfUsefulButMiss++;
+    // All the prefetchers sharing the cache are notified, so the useful
+    // prefetch is handled by the one that issued it, and by the one
+    // attached to the cache if no prefetcher claims it. It is accounted
+    // like the other events, so a prefetcher and its parent agree.
+    RequestorID source;
+    if (cache->prefetchSource(pkt->getAddr(), pkt->isSecure(), source)) {
+        Base *top = cache->getPrefetcher();
+        Base *issuer = top->findSource(source);
+        if (issuer == this || (!issuer && top == this)) {
+            top->accountEvent(source, [&](Base &pf) {
+                pf.usefulPrefetches += 1;
+                pf.prefetchStats.pfUseful++;
+                if (miss)
+                    // This case happens when a demand hits on a prefetched
+                    // line that's not in the requested coherency state.
+                    pf.prefetchStats.pfUsefulButMiss++;
+                if (pf.pcStats) {
+                    pf.pcStats->prefetchUseful(pkt->getAddr(),
+                                               pkt->isSecure());
+                }
+            });
+        }
     }
 
     // Verify this access type is observed by prefetcher
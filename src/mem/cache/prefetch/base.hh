@@ -47,12 +47,14 @@
 #define __MEM_CACHE_PREFETCH_BASE_HH__
 
 #include <cstdint>
+#include <memory>
 
 #include "arch/generic/tlb.hh"
 #include "base/compiler.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "mem/cache/cache_blk.hh"
+#include "mem/cache/prefetch/pc_stats.hh"
 #include "mem/packet.hh"
 #include "mem/request.hh"
 #include "sim/byteswap.hh"
@@ -316,6 +318,10 @@ class Base : public ClockedObject
 
     bool hasBeenPrefetched(Addr addr, bool is_secure) const;
 
+    /** Determine if address has been prefetched by a given prefetcher */
+    bool hasBeenPrefetched(Addr addr, bool is_secure,
+                           RequestorID requestor) const;
+
     /** Determine if addresses are on the same page */
     bool samePage(Addr a, Addr b) const;
     /** Determine the address of the block in which a lays */
@@ -357,12 +363,46 @@ class Base : public ClockedObject
         /** The number of times a HW-prefetch is late
          * (hit in cache, MSHR, WB). */
         statistics::Formula pfLate;
+
+        /** The number of times a demand finds a HW-prefetch in flight. */
+        statistics::Scalar pfLateUseful;
+
+        /** The number of demand misses covered, fully or partially, by
+         * HW-prefetches. */
+        statistics::Formula pfCovered;
     } prefetchStats;
 
+    /**
+     * Stats of the prefetches of every PC, if they are enabled. They are
+     * only accounted by the prefetchers that issue prefetches.
+     */
+    std::unique_ptr<PCStats> pcStats;
+
+    /**
+     * Account an event of a prefetch in this prefetcher, which counts the
+     * events of all the prefetches sent to its cache, and in the prefetcher
+     * that issued it, if it is another one.
+     *
+     * @param requestor Requestor ID of the prefetch.
+     * @param f Function accounting the event in a prefetcher.
+     */
+    template <typename F>
+    void
+    accountEvent(RequestorID requestor, F &&f)
+    {
+        f(*this);
+        Base *source = findSource(requestor);
+        if (source && source != this) {
+            f(*source);
+        }
+    }
+
     /** Total prefetches issued */
     uint64_t issuedPrefetches;
     /** Total prefetches that has been useful */
     uint64_t usefulPrefetches;
+    /** Total prefetches that were still in flight when they were needed */
+    uint64_t latePrefetches;
 
     /** Registered tlb for address translations */
     BaseTLB * tlb;
@@ -383,40 +423,81 @@ class Base : public ClockedObject
     virtual void notifyFill(const PacketPtr &pkt)
     {}
 
+    /**
+     * Notify prefetcher that one of its prefetches has evicted a block.
+     *
+     * @param addr The address of the evicted block.
+     * @param is_secure Whether the evicted block is in the secure space.
+     */
+    virtual void notifyPrefetchEviction(Addr addr, bool is_secure)
+    {}
+
     virtual PacketPtr getPacket() = 0;
 
     virtual Tick nextPrefetchReadyTime() const = 0;
 
-    void
-    prefetchUnused()
+    /**
+     * Find the prefetcher that issues the prefetches of a requestor ID,
+     * among this one and its sub-prefetchers.
+     *
+     * @param requestor The requestor ID.
+     * @return The prefetcher, or nullptr if none has that ID.
+     */
+    virtual Base *
+    findSource(RequestorID requestor)
     {
-        prefetchStats.pfUnused++;
+        return (requestor == requestorId) ? this : nullptr;
     }
 
-    void
-    incrDemandMhsrMisses()
-    {
-        prefetchStats.demandMshrMisses++;
-    }
+    /**
+     * A prefetched block has been evicted before being used.
+     *
+     * @param addr The address of the block.
+     * @param is_secure Whether the block is in the secure space.
+     * @param requestor Requestor ID of the prefetch that filled it.
+     */
+    void prefetchUnused(Addr addr, bool is_secure, RequestorID requestor);
 
-    void
-    pfHitInCache()
-    {
-        prefetchStats.pfHitInCache++;
-    }
+    /**
+     * A demand has requested a block whose prefetch is in flight.
+     *
+     * @param pf_pkt The packet of the prefetch.
+     */
+    void prefetchLate(const PacketPtr &pf_pkt);
 
+    /**
+     * A prefetch fill has evicted a block from the cache.
+     *
+     * @param addr The address of the evicted block.
+     * @param is_secure Whether the evicted block is in the secure space.
+     * @param requestor Requestor ID of the prefetch.
+     */
     void
-    pfHitInMSHR()
+    prefetchEviction(Addr addr, bool is_secure, RequestorID requestor)
     {
-        prefetchStats.pfHitInMSHR++;
+        if (Base *source = findSource(requestor)) {
+            source->notifyPrefetchEviction(addr, is_secure);
+        }
     }
 
     void
-    pfHitInWB()
+    incrDemandMhsrMisses()
     {
-        prefetchStats.pfHitInWB++;
+        prefetchStats.demandMshrMisses++;
     }
 
+    /**
+     * @{
+     * An issued prefetch has been dropped because its block is already in
+     * the cache, in a MSHR or in the write buffer.
+     *
+     * @param pkt The packet of the prefetch.
+     */
+    void pfHitInCache(const PacketPtr &pkt);
+    void pfHitInMSHR(const PacketPtr &pkt);
+    void pfHitInWB(const PacketPtr &pkt);
+    /** @} */
+
     /**
      * Register probe points for this object.
      */
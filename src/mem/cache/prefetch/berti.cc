@@ -0,0 +1,273 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/prefetch/berti.hh"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/HWPrefetch.hh"
+#include "mem/cache/prefetch/associative_set_impl.hh"
+#include "params/BertiPrefetcher.hh"
+
+namespace gem5
+{
+
+namespace prefetch
+{
+
+Berti::PCEntry::PCEntry(unsigned history_length, unsigned num_deltas)
+  : TaggedEntry(), history(history_length), historyHead(0),
+    historySize(0), deltas(num_deltas), searches(0)
+{
+}
+
+void
+Berti::PCEntry::invalidate()
+{
+    TaggedEntry::invalidate();
+    historyHead = 0;
+    historySize = 0;
+    for (auto &delta : deltas) {
+        delta = {0, 0, 0};
+    }
+    searches = 0;
+}
+
+Berti::Berti(const BertiPrefetcherParams &p)
+  : Queued(p), historyLength(p.history_length),
+    searchInterval(p.search_interval),
+    lowCoverage(p.low_coverage_threshold),
+    highCoverage(p.high_coverage_threshold), maxDelta(p.max_delta),
+    pcTable(p.table_assoc, p.table_entries, p.table_indexing_policy,
+            p.table_replacement_policy,
+            PCEntry(p.history_length, p.num_deltas)),
+    inFlight(p.in_flight_entries), latencies(p.latency_entries)
+{
+    fatal_if(historyLength == 0 || p.num_deltas == 0,
+        "%s: The history and the delta lists must not be empty.\n", name());
+    fatal_if(searchInterval == 0, "%s: The search interval must not be "
+        "empty.\n", name());
+    fatal_if(lowCoverage > highCoverage, "%s: The low coverage threshold "
+        "must not exceed the high one.\n", name());
+    fatal_if(inFlight.empty() || latencies.empty(), "%s: The latency "
+        "tables must not be empty.\n", name());
+}
+
+void
+Berti::startFetch(Addr addr, bool is_secure, bool prefetch, Addr blk_num,
+                  Addr pc)
+{
+    // Overwrite any older fetch, whose latency will not be known
+    InFlightEntry &entry = slot(inFlight, addr);
+    entry.valid = true;
+    entry.secure = is_secure;
+    entry.prefetch = prefetch;
+    entry.addr = addr;
+    entry.blkNum = blk_num;
+    entry.pc = pc;
+    entry.tick = curTick();
+}
+
+void
+Berti::train(PCEntry &entry, Addr blk_num, Tick tick, Tick latency)
+{
+    entry.searches++;
+
+    // Only the accesses that happened at least a fetch latency earlier
+    // could have prefetched the block in time
+    std::vector<int64_t> found;
+    for (unsigned i = 0; i < entry.historySize; i++) {
+        const Access &access =
+            entry.history[(entry.historyHead + i) % historyLength];
+        if (access.tick + latency > tick) {
+            continue;
+        }
+        const int64_t delta = int64_t(blk_num) - int64_t(access.blkNum);
+        if (delta == 0 || std::abs(delta) > maxDelta) {
+            continue;
+        }
+        // A delta is only accounted once per search
+        if (std::find(found.begin(), found.end(), delta) == found.end()) {
+            found.push_back(delta);
+            addDelta(entry, delta);
+        }
+    }
+
+    if (entry.searches == searchInterval) {
+        updateCoverage(entry);
+    }
+}
+
+void
+Berti::addDelta(PCEntry &entry, int64_t delta)
+{
+    Delta *victim = nullptr;
+    for (auto &d : entry.deltas) {
+        if (d.delta == delta) {
+            d.counter++;
+            return;
+        }
+        // Prefer free entries, and then the entries of the deltas that
+        // are not prefetched and have been found the fewest times
+        if (d.delta == 0) {
+            if (!victim || victim->delta != 0) {
+                victim = &d;
+            }
+        } else if (d.coverage < lowCoverage &&
+                   (!victim || (victim->delta != 0 &&
+                                d.counter < victim->counter))) {
+            victim = &d;
+        }
+    }
+
+    if (victim) {
+        *victim = {delta, 1, 0};
+    }
+}
+
+void
+Berti::updateCoverage(PCEntry &entry)
+{
+    for (auto &d : entry.deltas) {
+        if (d.delta == 0) {
+            continue;
+        }
+        d.coverage = (d.counter * 100) / entry.searches;
+        d.counter = 0;
+        if (d.coverage == 0) {
+            d.delta = 0;
+        }
+    }
+    entry.searches = 0;
+}
+
+void
+Berti::calculatePrefetch(const PrefetchInfo &pfi,
+                         std::vector<AddrPriority> &addresses)
+{
+    if (!pfi.hasPC()) {
+        DPRINTF(HWPrefetch, "Ignoring request with no PC.\n");
+        return;
+    }
+
+    const Addr pc = pfi.getPC();
+    const bool is_secure = pfi.isSecure();
+    const Addr paddr = blockAddress(pfi.getPaddr());
+    const Addr blk_num = pfi.getAddr() >> lBlkSize;
+
+    // Berti only learns from the accesses that would miss without it
+    const bool prefetch_hit = !pfi.isCacheMiss() &&
+        hasBeenPrefetched(paddr, is_secure, requestorId);
+    if (!pfi.isCacheMiss() && !prefetch_hit) {
+        return;
+    }
+
+    PCEntry *entry = pcTable.findEntry(pc, is_secure);
+    if (entry) {
+        pcTable.accessEntry(entry);
+    } else {
+        entry = pcTable.findVictim(pc);
+        pcTable.insertEntry(pc, is_secure, entry);
+    }
+
+    if (pfi.isCacheMiss()) {
+        // The timely deltas are searched when the miss is filled
+        startFetch(paddr, is_secure, false, blk_num, pc);
+    } else {
+        LatencyEntry &latency = slot(latencies, paddr);
+        if (latency.valid && latency.addr == paddr &&
+            latency.secure == is_secure) {
+            train(*entry, blk_num, curTick(), latency.latency);
+            latency.valid = false;
+        }
+    }
+
+    // Record the access
+    if (entry->historySize < historyLength) {
+        entry->history[(entry->historyHead + entry->historySize) %
+                       historyLength] = {blk_num, curTick()};
+        entry->historySize++;
+    } else {
+        entry->history[entry->historyHead] = {blk_num, curTick()};
+        entry->historyHead = (entry->historyHead + 1) % historyLength;
+    }
+
+    for (const auto &d : entry->deltas) {
+        if (d.delta != 0 && d.coverage >= lowCoverage) {
+            const Addr pf_addr = (blk_num + d.delta) << lBlkSize;
+            // Deltas below the high coverage threshold get the low
+            // priority, so that they can be inserted close to eviction
+            const int32_t priority = (d.coverage >= highCoverage) ?
+                HighPriority : LowPriority;
+            DPRINTF(HWPrefetch, "Berti: PC %#x delta %d coverage %d%%\n",
+                    pc, d.delta, d.coverage);
+            addresses.push_back(AddrPriority(pf_addr, priority));
+        }
+    }
+}
+
+PacketPtr
+Berti::getPacket()
+{
+    PacketPtr pkt = Queued::getPacket();
+    if (pkt) {
+        startFetch(blockAddress(pkt->getAddr()), pkt->isSecure(), true, 0,
+                   0);
+    }
+    return pkt;
+}
+
+void
+Berti::notifyFill(const PacketPtr &pkt)
+{
+    const Addr addr = blockAddress(pkt->getAddr());
+    InFlightEntry &fetch = slot(inFlight, addr);
+    if (!fetch.valid || fetch.addr != addr ||
+        fetch.secure != pkt->isSecure()) {
+        return;
+    }
+    fetch.valid = false;
+
+    const Tick latency = curTick() - fetch.tick;
+    if (fetch.prefetch) {
+        // Training happens when the prefetched block is demanded
+        LatencyEntry &entry = slot(latencies, addr);
+        entry.valid = true;
+        entry.secure = fetch.secure;
+        entry.addr = addr;
+        entry.latency = latency;
+    } else if (PCEntry *entry = pcTable.findEntry(fetch.pc, fetch.secure)) {
+        train(*entry, fetch.blkNum, fetch.tick, latency);
+    }
+}
+
+} // namespace prefetch
+} // namespace gem5
@@ -0,0 +1,238 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Implementation of the Berti prefetcher
+ * Reference:
+ *    Berti: an Accurate Local-Delta Data Prefetcher.
+ *    Navarro-Torres, A., Panda, B., Alastruey-Benede, J., Ibanez, P.,
+ *    Vinals-Yufera, V., & Ros, A. (2022).
+ *    55th IEEE/ACM International Symposium on Microarchitecture (MICRO).
+ *
+ * Notes:
+ * - The history and the deltas of a PC are kept in the same entry of a
+ *   single table, instead of in two separate tables.
+ * - Deltas with medium coverage, which the original proposal prefetches
+ *   into the next cache level, are prefetched into this cache with a low
+ *   priority, so that replacement policies that honour the priority of
+ *   prefetches can insert them close to eviction.
+ */
+
+#ifndef __MEM_CACHE_PREFETCH_BERTI_HH__
+#define __MEM_CACHE_PREFETCH_BERTI_HH__
+
+#include <cstdint>
+#include <vector>
+
+#include "base/types.hh"
+#include "mem/cache/prefetch/associative_set.hh"
+#include "mem/cache/prefetch/queued.hh"
+#include "mem/packet.hh"
+
+namespace gem5
+{
+
+struct BertiPrefetcherParams;
+
+namespace prefetch
+{
+
+/**
+ * Berti learns, for every PC, the deltas between the blocks it accesses
+ * that would have been timely: a delta from an older access of the PC is
+ * only accounted if that access happened at least one fetch latency before
+ * the access the delta leads to. The fetch latency of every miss and
+ * prefetch is measured when its block is filled. The deltas that cover
+ * the most accesses of the PC are prefetched on its following accesses.
+ */
+class Berti : public Queued
+{
+  protected:
+    /** Number of accesses kept in the history of a PC. */
+    const unsigned historyLength;
+
+    /** Number of searches of timely deltas between coverage updates. */
+    const unsigned searchInterval;
+
+    /** Coverage, in percent, above which a delta is prefetched. */
+    const unsigned lowCoverage;
+
+    /** Coverage, in percent, of the deltas prefetched with priority. */
+    const unsigned highCoverage;
+
+    /**
+     * Priorities of the prefetches of the deltas with a high and a medium
+     * coverage. Replacement policies whose prefetch priority threshold is
+     * HighPriority insert the latter close to eviction.
+     */
+    static constexpr int32_t HighPriority = 1;
+    static constexpr int32_t LowPriority = 0;
+
+    /** Maximum absolute value of a delta, in blocks. */
+    const int64_t maxDelta;
+
+    /** A recent access of a PC. */
+    struct Access
+    {
+        /** Block number of the access. */
+        Addr blkNum;
+        /** When the access happened. */
+        Tick tick;
+    };
+
+    /** A delta of a PC, and how many accesses it covers. */
+    struct Delta
+    {
+        /** The delta, in blocks. Zero if the entry is unused. */
+        int64_t delta;
+        /** Number of searches it has been found in since the last update. */
+        unsigned counter;
+        /** Percentage of the searches it was found in at the last update. */
+        unsigned coverage;
+    };
+
+    /** Tagged by PC. */
+    struct PCEntry : public TaggedEntry
+    {
+        PCEntry(unsigned history_length, unsigned num_deltas);
+
+        void invalidate() override;
+
+        /** Recent accesses, as a circular buffer. */
+        std::vector<Access> history;
+        /** Position of the oldest access in the history. */
+        unsigned historyHead;
+        /** Number of valid accesses in the history. */
+        unsigned historySize;
+
+        /** Deltas whose coverage is tracked. */
+        std::vector<Delta> deltas;
+        /** Number of searches since the last coverage update. */
+        unsigned searches;
+    };
+
+    AssociativeSet<PCEntry> pcTable;
+
+    /** A miss or prefetch whose fetch latency is being measured. */
+    struct InFlightEntry
+    {
+        bool valid = false;
+        bool secure = false;
+        /** Whether it was issued by this prefetcher. */
+        bool prefetch = false;
+        /** Physical block address. */
+        Addr addr = 0;
+        /** Block number used for training. */
+        Addr blkNum = 0;
+        /** PC of the access that missed. */
+        Addr pc = 0;
+        /** When the miss happened or the prefetch was issued. */
+        Tick tick = 0;
+    };
+
+    /** Outstanding misses and prefetches, indexed by block address. */
+    std::vector<InFlightEntry> inFlight;
+
+    /** The fetch latency of a prefetched block that has not been used. */
+    struct LatencyEntry
+    {
+        bool valid = false;
+        bool secure = false;
+        /** Physical block address. */
+        Addr addr = 0;
+        Tick latency = 0;
+    };
+
+    /** Latencies of the prefetched blocks, indexed by block address. */
+    std::vector<LatencyEntry> latencies;
+
+    /**
+     * Get the entry a block maps to in a table indexed by block address.
+     */
+    template <typename T>
+    T &
+    slot(std::vector<T> &table, Addr addr)
+    {
+        return table[(addr >> lBlkSize) % table.size()];
+    }
+
+    /**
+     * Start measuring the fetch latency of a block.
+     *
+     * @param addr The physical address of the block.
+     * @param is_secure Whether the block is in the secure space.
+     * @param prefetch Whether the fetch is a prefetch of this prefetcher.
+     * @param blk_num Block number used for training.
+     * @param pc PC of the access that missed.
+     */
+    void startFetch(Addr addr, bool is_secure, bool prefetch, Addr blk_num,
+                    Addr pc);
+
+    /**
+     * Search the history of a PC for the accesses from which the given
+     * access could have been prefetched in time, and account their deltas.
+     *
+     * @param entry The entry of the PC.
+     * @param blk_num Block number of the access.
+     * @param tick When the access happened.
+     * @param latency The fetch latency of the block of the access.
+     */
+    void train(PCEntry &entry, Addr blk_num, Tick tick, Tick latency);
+
+    /**
+     * Account a timely delta found in a search.
+     *
+     * @param entry The entry of the PC.
+     * @param delta The delta.
+     */
+    void addDelta(PCEntry &entry, int64_t delta);
+
+    /**
+     * Update the coverage of the deltas of a PC, and free the deltas that
+     * have not been found.
+     *
+     * @param entry The entry of the PC.
+     */
+    void updateCoverage(PCEntry &entry);
+
+  public:
+    Berti(const BertiPrefetcherParams &p);
+    ~Berti() = default;
+
+    void calculatePrefetch(const PrefetchInfo &pfi,
+                           std::vector<AddrPriority> &addresses) override;
+
+    PacketPtr getPacket() override;
+
+    void notifyFill(const PacketPtr &pkt) override;
+};
+
+} // namespace prefetch
+} // namespace gem5
+
+#endif // __MEM_CACHE_PREFETCH_BERTI_HH__
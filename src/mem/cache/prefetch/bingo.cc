@@ -0,0 +1,193 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/prefetch/bingo.hh"
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/HWPrefetch.hh"
+#include "mem/cache/prefetch/associative_set_impl.hh"
+#include "params/BingoPrefetcher.hh"
+
+namespace gem5
+{
+
+namespace prefetch
+{
+
+Bingo::AccumulationEntry::AccumulationEntry()
+  : TaggedEntry(), region(0), pc(0), offset(0), footprint(0)
+{
+}
+
+Bingo::PatternEntry::PatternEntry()
+  : TaggedEntry(), region(0), pc(0), offset(0), footprint(0)
+{
+}
+
+void
+Bingo::PatternEntry::invalidate()
+{
+    TaggedEntry::invalidate();
+    region = 0;
+    pc = 0;
+    offset = 0;
+    footprint = 0;
+}
+
+Bingo::Bingo(const BingoPrefetcherParams &p)
+  : Queued(p), regionSize(p.region_size),
+    regionBlksBits(floorLog2(p.region_size / p.block_size)),
+    voteThreshold(p.vote_threshold),
+    accumulationTable(p.accumulation_table_assoc,
+                      p.accumulation_table_entries,
+                      p.accumulation_table_indexing_policy,
+                      p.accumulation_table_replacement_policy),
+    patternHistoryTable(p.pattern_history_table_assoc,
+                        p.pattern_history_table_entries,
+                        p.pattern_history_table_indexing_policy,
+                        p.pattern_history_table_replacement_policy)
+{
+    fatal_if(!isPowerOf2(regionSize) || regionSize < blkSize,
+        "%s: The region size must be a power of 2, and at least a block.\n",
+        name());
+    fatal_if(regionSize / blkSize > sizeof(Footprint) * 8,
+        "%s: A region must not have more than %d blocks.\n", name(),
+        sizeof(Footprint) * 8);
+}
+
+void
+Bingo::recordGeneration(const AccumulationEntry &entry)
+{
+    // Generations that only accessed their trigger block have nothing to
+    // prefetch
+    if (entry.footprint == (Footprint(1) << entry.offset)) {
+        return;
+    }
+
+    const Addr key = patternKey(entry.pc, entry.offset);
+    PatternEntry *pattern = nullptr;
+    for (PatternEntry *candidate :
+            patternHistoryTable.getPossibleEntries(key)) {
+        if (candidate->isValid() && candidate->pc == entry.pc &&
+            candidate->offset == entry.offset &&
+            candidate->region == entry.region) {
+            pattern = candidate;
+            break;
+        }
+    }
+
+    if (pattern) {
+        patternHistoryTable.accessEntry(pattern);
+    } else {
+        pattern = patternHistoryTable.findVictim(key);
+        patternHistoryTable.insertEntry(key, false /*unused*/, pattern);
+        pattern->region = entry.region;
+        pattern->pc = entry.pc;
+        pattern->offset = entry.offset;
+    }
+    pattern->footprint = entry.footprint;
+}
+
+void
+Bingo::calculatePrefetch(const PrefetchInfo &pfi,
+                         std::vector<AddrPriority> &addresses)
+{
+    if (!pfi.hasPC()) {
+        DPRINTF(HWPrefetch, "Ignoring request with no PC.\n");
+        return;
+    }
+
+    const Addr addr = pfi.getAddr();
+    const bool is_secure = pfi.isSecure();
+    const Addr region = addr & ~Addr(regionSize - 1);
+    const unsigned offset = (addr & (regionSize - 1)) >> lBlkSize;
+
+    // Accumulate the accesses of the active generations
+    AccumulationEntry *entry =
+        accumulationTable.findEntry(region, is_secure);
+    if (entry) {
+        accumulationTable.accessEntry(entry);
+        entry->footprint |= Footprint(1) << offset;
+        return;
+    }
+
+    // This access triggers a new generation. The victim has already been
+    // invalidated, but its footprint tells whether it held a generation
+    entry = accumulationTable.findVictim(region);
+    if (entry->footprint) {
+        recordGeneration(*entry);
+    }
+    accumulationTable.insertEntry(region, is_secure, entry);
+    entry->region = region;
+    entry->pc = pfi.getPC();
+    entry->offset = offset;
+    entry->footprint = Footprint(1) << offset;
+
+    // Look for the footprint of the same trigger event, and count how many
+    // footprints of the same PC and offset contain every block
+    const Addr key = patternKey(entry->pc, offset);
+    std::vector<unsigned> votes(regionSize / blkSize, 0);
+    unsigned num_matches = 0;
+    const PatternEntry *exact_match = nullptr;
+    for (PatternEntry *candidate :
+            patternHistoryTable.getPossibleEntries(key)) {
+        if (!candidate->isValid() || candidate->pc != entry->pc ||
+            candidate->offset != offset) {
+            continue;
+        }
+        if (candidate->region == region) {
+            exact_match = candidate;
+            break;
+        }
+        num_matches++;
+        for (unsigned blk = 0; blk < votes.size(); blk++) {
+            votes[blk] += (candidate->footprint >> blk) & 1;
+        }
+    }
+
+    for (unsigned blk = 0; blk < votes.size(); blk++) {
+        if (blk == offset) {
+            continue;
+        }
+        const Addr pf_addr = region + (Addr(blk) << lBlkSize);
+        if (exact_match) {
+            if ((exact_match->footprint >> blk) & 1) {
+                addresses.push_back(AddrPriority(pf_addr, 100));
+            }
+        } else if (num_matches && votes[blk] &&
+                   votes[blk] * 100 >= voteThreshold * num_matches) {
+            addresses.push_back(AddrPriority(pf_addr,
+                                             votes[blk] * 100 / num_matches));
+        }
+    }
+}
+
+} // namespace prefetch
+} // namespace gem5
@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Implementation of the Bingo spatial data prefetcher
+ * Reference:
+ *    Bingo Spatial Data Prefetcher.
+ *    Bakhshalipour, M., Shakerinava, M., Lotfi-Kamran, P., &
+ *    Sarbazi-Azad, H. (2019).
+ *    IEEE International Symposium on High Performance Computer
+ *    Architecture (HPCA).
+ *
+ * Notes:
+ * - The generation of a region ends when its entry is evicted from the
+ *   accumulation table, instead of when one of its blocks is evicted from
+ *   the cache, which the prefetcher is not notified of.
+ * - The filter table is not modeled separately: regions with a single
+ *   accessed block are simply not recorded in the pattern history table.
+ */
+
+#ifndef __MEM_CACHE_PREFETCH_BINGO_HH__
+#define __MEM_CACHE_PREFETCH_BINGO_HH__
+
+#include <cstdint>
+#include <vector>
+
+#include "base/types.hh"
+#include "mem/cache/prefetch/associative_set.hh"
+#include "mem/cache/prefetch/queued.hh"
+
+namespace gem5
+{
+
+struct BingoPrefetcherParams;
+
+namespace prefetch
+{
+
+/**
+ * Bingo records the footprint of the blocks accessed in a spatial region
+ * during a generation, and associates it with the event that triggered
+ * the generation: the PC and address of its first access. When a new
+ * generation starts, the footprint of the same PC and address is
+ * prefetched. Otherwise, the footprints recorded for the same PC and
+ * offset within the region vote on which blocks to prefetch.
+ */
+class Bingo : public Queued
+{
+  protected:
+    /** Size of a spatial region. */
+    const unsigned regionSize;
+
+    /** log_2 of the number of blocks of a region. */
+    const unsigned regionBlksBits;
+
+    /**
+     * Percentage of the footprints matching the PC and offset of a trigger
+     * that must contain a block for it to be prefetched.
+     */
+    const unsigned voteThreshold;
+
+    /** Footprint of a region, one bit per block. */
+    using Footprint = uint64_t;
+
+    /** A generation in progress, tagged by region address. */
+    struct AccumulationEntry : public TaggedEntry
+    {
+        AccumulationEntry();
+
+        /** Address of the region. */
+        Addr region;
+        /** PC of the trigger access. */
+        Addr pc;
+        /** Block offset of the trigger access within the region. */
+        unsigned offset;
+        /**
+         * Blocks accessed during the generation. It is only zero in entries
+         * that never held a generation, and it is kept when the entry is
+         * invalidated, so that the generations of victims can be recorded.
+         */
+        Footprint footprint;
+    };
+
+    AssociativeSet<AccumulationEntry> accumulationTable;
+
+    /** A recorded generation, indexed by the PC and offset of its trigger. */
+    struct PatternEntry : public TaggedEntry
+    {
+        PatternEntry();
+
+        void invalidate() override;
+
+        /** Address of the region, which completes the trigger event. */
+        Addr region;
+        /** PC of the trigger access. */
+        Addr pc;
+        /** Block offset of the trigger access within the region. */
+        unsigned offset;
+        /** Blocks accessed during the generation. */
+        Footprint footprint;
+    };
+
+    AssociativeSet<PatternEntry> patternHistoryTable;
+
+    /** Get the key of the pattern history table of a PC and offset. */
+    Addr
+    patternKey(Addr pc, unsigned offset) const
+    {
+        return (pc << regionBlksBits) | offset;
+    }
+
+    /**
+     * Record the footprint of a generation that has ended.
+     *
+     * @param entry The entry of the generation.
+     */
+    void recordGeneration(const AccumulationEntry &entry);
+
+  public:
+    Bingo(const BingoPrefetcherParams &p);
+    ~Bingo() = default;
+
+    void calculatePrefetch(const PrefetchInfo &pfi,
+                           std::vector<AddrPriority> &addresses) override;
+};
+
+} // namespace prefetch
+} // namespace gem5
+
+#endif // __MEM_CACHE_PREFETCH_BINGO_HH__
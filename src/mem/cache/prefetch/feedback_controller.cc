@@ -0,0 +1,193 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/prefetch/feedback_controller.hh"
+
+#include <algorithm>
+
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/HWPrefetch.hh"
+#include "mem/mem_ctrl.hh"
+#include "params/PrefetchFeedbackController.hh"
+
+namespace gem5
+{
+
+namespace prefetch
+{
+
+FeedbackController::FeedbackController(const Params &p)
+    : SimObject(p), level(p.start_level),
+      intervalAccesses(p.interval), accuracyHigh(p.accuracy_high),
+      accuracyLow(p.accuracy_low), latenessThreshold(p.lateness_threshold),
+      pollutionThreshold(p.pollution_threshold), memCtrl(p.mem_ctrl),
+      bandwidthThreshold(p.bandwidth_threshold),
+      pollutionFilter(p.pollution_filter_entries, false),
+      accesses(0), demandMisses(0), pollutionMisses(0), occupancySum(0),
+      lastIssued(0), lastUseful(0), lastLate(0), avgIssued(0),
+      avgUseful(0), avgLate(0), avgMisses(0), avgPollution(0),
+      stats(this, p.degrees.size())
+{
+    fatal_if(p.degrees.empty(), "%s: There must be at least one "
+        "aggressiveness level.\n", name());
+    fatal_if(p.degrees.size() != p.distances.size(), "%s: Every "
+        "aggressiveness level must have a degree and a distance.\n", name());
+    fatal_if(level >= p.degrees.size(), "%s: The starting level must be "
+        "one of the aggressiveness levels.\n", name());
+    fatal_if(intervalAccesses == 0, "%s: The interval must not be empty.\n",
+        name());
+    fatal_if(pollutionFilter.empty(), "%s: The pollution filter must have "
+        "at least one entry.\n", name());
+    fatal_if(accuracyLow > accuracyHigh, "%s: The low accuracy threshold "
+        "must not exceed the high one.\n", name());
+
+    for (std::size_t i = 0; i < p.degrees.size(); i++) {
+        fatal_if(p.degrees[i] == 0 || p.distances[i] < p.degrees[i],
+            "%s: The degree of a level must be non-zero, and not exceed "
+            "its distance.\n", name());
+        levels.push_back({p.degrees[i], p.distances[i]});
+    }
+}
+
+std::vector<bool>::reference
+FeedbackController::filterEntry(Addr addr, bool is_secure)
+{
+    // Block addresses have room for the security bit
+    const Addr key = addr | Addr(is_secure);
+    return pollutionFilter[((key * 0x9e3779b97f4a7c15ULL) >> 32) %
+                           pollutionFilter.size()];
+}
+
+bool
+FeedbackController::notifyAccess(Addr addr, bool is_secure, bool miss)
+{
+    if (miss) {
+        demandMisses++;
+
+        // A miss to a block evicted by a prefetch would likely have hit
+        // without the prefetcher
+        auto entry = filterEntry(addr, is_secure);
+        if (entry) {
+            pollutionMisses++;
+            stats.pollutionMisses++;
+            entry = false;
+        }
+    }
+
+    if (memCtrl) {
+        occupancySum += memCtrl->readQueueOccupancy();
+    }
+
+    return ++accesses == intervalAccesses;
+}
+
+void
+FeedbackController::notifyEviction(Addr addr, bool is_secure)
+{
+    filterEntry(addr, is_secure) = true;
+}
+
+void
+FeedbackController::update(uint64_t issued, uint64_t useful, uint64_t late)
+{
+    // Average the events of this interval with the previous ones
+    avgIssued = (avgIssued + (issued - lastIssued)) / 2;
+    avgUseful = (avgUseful + (useful - lastUseful)) / 2;
+    avgLate = (avgLate + (late - lastLate)) / 2;
+    avgMisses = (avgMisses + demandMisses) / 2;
+    avgPollution = (avgPollution + pollutionMisses) / 2;
+    lastIssued = issued;
+    lastUseful = useful;
+    lastLate = late;
+
+    // Late prefetches have been demanded too, so they are accurate
+    const double demanded = avgUseful + avgLate;
+    const double accuracy = (avgIssued > 0) ? demanded / avgIssued : 0;
+    const bool is_late = (demanded > 0) &&
+        (avgLate / demanded > latenessThreshold);
+    const bool is_polluting = (avgMisses > 0) &&
+        (avgPollution / avgMisses > pollutionThreshold);
+
+    // Prefetching earlier only pays off if the prefetches are accurate
+    // enough to cover the pollution they cause
+    int change = 0;
+    if (accuracy >= accuracyHigh) {
+        change = is_late ? 1 : (is_polluting ? -1 : 0);
+    } else if (accuracy >= accuracyLow) {
+        change = is_polluting ? -1 : (is_late ? 1 : 0);
+    } else {
+        change = (is_late || is_polluting) ? -1 : 0;
+    }
+
+    // Do not add prefetches to a memory that is already saturated
+    if (memCtrl && change >= 0 &&
+        occupancySum / accesses > bandwidthThreshold) {
+        change = -1;
+        stats.bandwidthDecrements++;
+    }
+
+    if (change > 0 && level + 1 < levels.size()) {
+        level++;
+        stats.increments++;
+    } else if (change < 0 && level > 0) {
+        level--;
+        stats.decrements++;
+    }
+
+    DPRINTF(HWPrefetch, "Feedback: accuracy %.3f, late %d, polluting %d, "
+            "level %d (degree %d, distance %d)\n", accuracy, is_late,
+            is_polluting, level, degree(), distance());
+
+    stats.levelIntervals[level]++;
+    accesses = 0;
+    demandMisses = 0;
+    pollutionMisses = 0;
+    occupancySum = 0;
+}
+
+FeedbackController::FeedbackStats::FeedbackStats(statistics::Group *parent,
+    std::size_t num_levels)
+    : statistics::Group(parent),
+      ADD_STAT(levelIntervals, statistics::units::Count::get(),
+               "Number of intervals spent at every aggressiveness level"),
+      ADD_STAT(increments, statistics::units::Count::get(),
+               "Number of times the prefetcher became more aggressive"),
+      ADD_STAT(decrements, statistics::units::Count::get(),
+               "Number of times the prefetcher became less aggressive"),
+      ADD_STAT(bandwidthDecrements, statistics::units::Count::get(),
+               "Number of times the memory bandwidth pressure prevented "
+               "the prefetcher from keeping or raising its aggressiveness"),
+      ADD_STAT(pollutionMisses, statistics::units::Count::get(),
+               "Number of demand misses to blocks evicted by prefetches")
+{
+    levelIntervals.init(num_levels);
+}
+
+} // namespace prefetch
+} // namespace gem5
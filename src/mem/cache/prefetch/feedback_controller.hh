@@ -0,0 +1,205 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of a feedback directed controller of the aggressiveness of
+ * a prefetcher.
+ */
+
+#ifndef __MEM_CACHE_PREFETCH_FEEDBACK_CONTROLLER_HH__
+#define __MEM_CACHE_PREFETCH_FEEDBACK_CONTROLLER_HH__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+struct PrefetchFeedbackControllerParams;
+
+namespace memory
+{
+class MemCtrl;
+} // namespace memory
+
+namespace prefetch
+{
+
+/**
+ * Feedback directed prefetching controller, as described in:
+ * "Feedback Directed Prefetching: Improving the Performance and
+ * Bandwidth-Efficiency of Hardware Prefetchers", by S. Srinath et al.
+ *
+ * The controller samples the accuracy, lateness and cache pollution of
+ * the prefetches of a prefetcher over intervals of accesses, and moves
+ * the prefetcher across a list of aggressiveness levels, each defining
+ * a prefetch degree and distance. Every interval is averaged with the
+ * previous ones, so that a single interval does not cause big swings.
+ *
+ * The pollution is estimated with a filter of the blocks evicted by
+ * prefetches: a demand miss to one of them is accounted as caused by the
+ * prefetcher. If a memory controller is given, the prefetcher is also
+ * throttled down while the occupancy of its read queues is high.
+ *
+ * A controller keeps the state of a single prefetcher, so it must not be
+ * shared.
+ */
+class FeedbackController : public SimObject
+{
+  private:
+    /** An aggressiveness level. */
+    struct Level
+    {
+        unsigned degree;
+        unsigned distance;
+    };
+
+    /** The aggressiveness levels, from the least to the most aggressive. */
+    std::vector<Level> levels;
+
+    /** The current aggressiveness level. */
+    unsigned level;
+
+    /** Number of accesses in an interval. */
+    const unsigned intervalAccesses;
+
+    /** Accuracy above which the prefetcher is considered accurate. */
+    const double accuracyHigh;
+
+    /** Accuracy below which the prefetcher is considered inaccurate. */
+    const double accuracyLow;
+
+    /** Fraction of late useful prefetches above which they are late. */
+    const double latenessThreshold;
+
+    /** Fraction of demand misses above which the prefetcher pollutes. */
+    const double pollutionThreshold;
+
+    /** Memory controller whose occupancy is monitored, if any. */
+    memory::MemCtrl *const memCtrl;
+
+    /** Average read queue occupancy above which bandwidth is scarce. */
+    const double bandwidthThreshold;
+
+    /** Blocks recently evicted by prefetches, indexed by address hash. */
+    std::vector<bool> pollutionFilter;
+
+    /** @{ Events of the current interval. */
+    unsigned accesses;
+    uint64_t demandMisses;
+    uint64_t pollutionMisses;
+    double occupancySum;
+    /** @} */
+
+    /** @{ Prefetcher counters at the beginning of the interval. */
+    uint64_t lastIssued;
+    uint64_t lastUseful;
+    uint64_t lastLate;
+    /** @} */
+
+    /** @{ Events per interval, averaged over the past intervals. */
+    double avgIssued;
+    double avgUseful;
+    double avgLate;
+    double avgMisses;
+    double avgPollution;
+    /** @} */
+
+    /** Get the entry of a block in the pollution filter. */
+    std::vector<bool>::reference filterEntry(Addr addr, bool is_secure);
+
+    struct FeedbackStats : public statistics::Group
+    {
+        FeedbackStats(statistics::Group *parent, std::size_t num_levels);
+
+        /** Number of intervals spent at every level. */
+        statistics::Vector levelIntervals;
+
+        /** Number of times the prefetcher became more aggressive. */
+        statistics::Scalar increments;
+
+        /** Number of times the prefetcher became less aggressive. */
+        statistics::Scalar decrements;
+
+        /** Number of decrements caused by memory bandwidth pressure. */
+        statistics::Scalar bandwidthDecrements;
+
+        /** Number of demand misses to blocks evicted by prefetches. */
+        statistics::Scalar pollutionMisses;
+    } stats;
+
+  public:
+    using Params = PrefetchFeedbackControllerParams;
+    FeedbackController(const Params &p);
+
+    /** Get the number of prefetches to generate per access. */
+    unsigned degree() const { return levels[level].degree; }
+
+    /** Get how many prefetches ahead of the accesses to prefetch. */
+    unsigned distance() const { return levels[level].distance; }
+
+    /**
+     * Notify the controller of an access observed by the prefetcher.
+     *
+     * @param addr The block address of the access.
+     * @param is_secure Whether the access is to the secure space.
+     * @param miss Whether the access missed in the cache.
+     * @return Whether the access ends an interval, in which case the
+     *         controller must be updated.
+     */
+    bool notifyAccess(Addr addr, bool is_secure, bool miss);
+
+    /**
+     * Notify the controller that a prefetch has evicted a block.
+     *
+     * @param addr The block address of the evicted block.
+     * @param is_secure Whether the block is in the secure space.
+     */
+    void notifyEviction(Addr addr, bool is_secure);
+
+    /**
+     * End an interval, updating the aggressiveness level according to the
+     * events of the interval.
+     *
+     * @param issued Total number of prefetches issued by the prefetcher.
+     * @param useful Total number of its prefetches used by demands.
+     * @param late Total number of its prefetches demanded while in flight.
+     */
+    void update(uint64_t issued, uint64_t useful, uint64_t late);
+};
+
+} // namespace prefetch
+} // namespace gem5
+
+#endif //__MEM_CACHE_PREFETCH_FEEDBACK_CONTROLLER_HH__
@@ -91,5 +91,16 @@ Multi::getPacket()
     return nullptr;
 }
 
+Base *
+Multi::findSource(RequestorID requestor)
+{
+    for (auto pf : prefetchers) {
+        if (Base *source = pf->findSource(requestor)) {
+            return source;
+        }
+    }
+    return Base::findSource(requestor);
+}
+
 } // namespace prefetch
 } // namespace gem5
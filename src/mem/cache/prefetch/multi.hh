@@ -59,6 +59,8 @@ class Multi : public Base
   public:
     void setCache(BaseCache *_cache) override;
     PacketPtr getPacket() override;
+
+    Base *findSource(RequestorID requestor) override;
     Tick nextPrefetchReadyTime() const override;
 
     /** @{ */
@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/prefetch/pc_stats.hh"
+
+#include <string>
+#include <vector>
+
+#include "base/cprintf.hh"
+
+namespace gem5
+{
+
+namespace prefetch
+{
+
+PCStats::PCStats(statistics::Group *parent, std::size_t num_pcs,
+                 std::size_t num_blocks)
+  : statistics::Group(parent, "pcStats"), table(num_pcs, num_blocks),
+    maxPCs(num_pcs),
+    ADD_STAT(issued, statistics::units::Count::get(),
+             "Number of prefetches issued by each PC"),
+    ADD_STAT(useful, statistics::units::Count::get(),
+             "Number of prefetches of each PC used by a demand"),
+    ADD_STAT(late, statistics::units::Count::get(),
+             "Number of prefetches of each PC still in flight when a "
+             "demand requested them"),
+    ADD_STAT(unused, statistics::units::Count::get(),
+             "Number of prefetches of each PC evicted before being used"),
+    ADD_STAT(covered, statistics::units::Count::get(),
+             "Number of demand misses covered, fully or partially, by the "
+             "prefetches of each PC")
+{
+    issued.init(maxPCs).flags(statistics::nozero);
+    useful.init(maxPCs).flags(statistics::nozero);
+    late.init(maxPCs).flags(statistics::nozero);
+    unused.init(maxPCs).flags(statistics::nozero);
+    covered.flags(statistics::nozero);
+    covered = useful + late;
+}
+
+void
+PCStats::preDumpStats()
+{
+    statistics::Group::preDumpStats();
+
+    // List the PCs that issued the most prefetches first
+    const std::vector<const PCTable::PCEntry *> entries = table.ranked();
+    for (std::size_t i = 0; i < maxPCs; i++) {
+        if (i < entries.size()) {
+            const PCTable::PCEntry &entry = *entries[i];
+            const std::string pc = csprintf("%#x", entry.pc);
+            issued.subname(i, pc);
+            useful.subname(i, pc);
+            late.subname(i, pc);
+            unused.subname(i, pc);
+            covered.subname(i, pc);
+            issued[i] = entry.issued;
+            useful[i] = entry.useful;
+            late[i] = entry.late;
+            unused[i] = entry.unused;
+        } else {
+            issued[i] = 0;
+            useful[i] = 0;
+            late[i] = 0;
+            unused[i] = 0;
+        }
+    }
+}
+
+void
+PCStats::resetStats()
+{
+    statistics::Group::resetStats();
+    table.resetCounts();
+}
+
+} // namespace prefetch
+} // namespace gem5
@@ -0,0 +1,137 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of the per-PC statistics of a prefetcher.
+ */
+
+#ifndef __MEM_CACHE_PREFETCH_PC_STATS_HH__
+#define __MEM_CACHE_PREFETCH_PC_STATS_HH__
+
+#include <cstddef>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "mem/cache/prefetch/pc_table.hh"
+
+namespace gem5
+{
+
+namespace prefetch
+{
+
+/**
+ * Accounts the fate of the prefetches of a prefetcher per PC of the access
+ * that triggered them, so that the PCs that generate useless or late
+ * prefetches can be identified.
+ *
+ * The PCs are accounted by a PCTable, which keeps a bounded number of
+ * them. The stats list the PCs from the highest rank to the lowest, and
+ * count the prefetches of every PC since it was accounted or the stats
+ * were reset.
+ */
+class PCStats : public statistics::Group
+{
+  private:
+    /** The accounted PCs. */
+    PCTable table;
+
+    /** Maximum number of PCs accounted. */
+    const std::size_t maxPCs;
+
+  public:
+    /**
+     * @param parent The prefetcher.
+     * @param num_pcs Maximum number of PCs accounted.
+     * @param num_blocks Number of prefetched blocks tracked at once.
+     */
+    PCStats(statistics::Group *parent, std::size_t num_pcs,
+            std::size_t num_blocks);
+
+    /** @sa PCTable::prefetchIssued() */
+    void
+    prefetchIssued(Addr addr, bool is_secure, Addr pc)
+    {
+        table.prefetchIssued(addr, is_secure, pc);
+    }
+
+    /** @sa PCTable::prefetchUseful() */
+    void
+    prefetchUseful(Addr addr, bool is_secure)
+    {
+        table.prefetchUseful(addr, is_secure);
+    }
+
+    /** @sa PCTable::prefetchLate() */
+    void
+    prefetchLate(Addr addr, bool is_secure)
+    {
+        table.prefetchLate(addr, is_secure);
+    }
+
+    /** @sa PCTable::prefetchUnused() */
+    void
+    prefetchUnused(Addr addr, bool is_secure)
+    {
+        table.prefetchUnused(addr, is_secure);
+    }
+
+    /** @sa PCTable::prefetchDropped() */
+    void
+    prefetchDropped(Addr addr, bool is_secure)
+    {
+        table.prefetchDropped(addr, is_secure);
+    }
+
+    void preDumpStats() override;
+    void resetStats() override;
+
+    /** Number of prefetches issued by each PC. */
+    statistics::Vector issued;
+
+    /** Number of prefetches of each PC used by a demand. */
+    statistics::Vector useful;
+
+    /** Number of prefetches of each PC still in flight when demanded. */
+    statistics::Vector late;
+
+    /** Number of prefetches of each PC evicted before being used. */
+    statistics::Vector unused;
+
+    /**
+     * Number of demand misses covered, fully or partially, by the
+     * prefetches of each PC.
+     */
+    statistics::Formula covered;
+};
+
+} // namespace prefetch
+} // namespace gem5
+
+#endif //__MEM_CACHE_PREFETCH_PC_STATS_HH__
@@ -0,0 +1,154 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/prefetch/pc_table.hh"
+
+#include <algorithm>
+
+namespace gem5
+{
+
+namespace prefetch
+{
+
+PCTable::PCTable(std::size_t num_pcs, std::size_t num_blocks)
+  : maxPCs(num_pcs), blocks(std::max<std::size_t>(num_blocks, 1))
+{
+    pcs.reserve(maxPCs);
+}
+
+PCTable::BlockEntry &
+PCTable::blockEntry(Addr addr)
+{
+    return blocks[((addr * 0x9e3779b97f4a7c15ULL) >> 32) % blocks.size()];
+}
+
+PCTable::PCEntry *
+PCTable::untrack(Addr addr, bool is_secure)
+{
+    BlockEntry &block = blockEntry(addr);
+    if (!block.valid || (block.addr != addr) ||
+        (block.secure != is_secure)) {
+        return nullptr;
+    }
+    block.valid = false;
+
+    // The PC may have been replaced since the prefetch was issued
+    const auto it = pcIndex.find(block.pc);
+    return (it == pcIndex.end()) ? nullptr : &pcs[it->second];
+}
+
+void
+PCTable::prefetchIssued(Addr addr, bool is_secure, Addr pc)
+{
+    PCEntry *entry;
+    const auto it = pcIndex.find(pc);
+    if (it != pcIndex.end()) {
+        entry = &pcs[it->second];
+    } else if (pcs.size() < maxPCs) {
+        pcIndex[pc] = pcs.size();
+        pcs.push_back(PCEntry{pc, 0, 0, 0, 0, 0, 0});
+        entry = &pcs.back();
+    } else {
+        // Replace the PC of lowest rank. The new PC may have issued as many
+        // prefetches as it before being accounted, so it inherits its
+        // estimate, which is also the error of the new estimate
+        entry = &*std::min_element(pcs.begin(), pcs.end(),
+            [](const PCEntry &a, const PCEntry &b)
+            { return b.ranksAbove(a); });
+        pcIndex.erase(entry->pc);
+        pcIndex[pc] = entry - pcs.data();
+        *entry = PCEntry{pc, entry->count, entry->count, 0, 0, 0, 0};
+    }
+    entry->count++;
+    entry->issued++;
+
+    BlockEntry &block = blockEntry(addr);
+    block.valid = true;
+    block.secure = is_secure;
+    block.addr = addr;
+    block.pc = pc;
+}
+
+void
+PCTable::prefetchUseful(Addr addr, bool is_secure)
+{
+    if (PCEntry *entry = untrack(addr, is_secure)) {
+        entry->useful++;
+    }
+}
+
+void
+PCTable::prefetchLate(Addr addr, bool is_secure)
+{
+    if (PCEntry *entry = untrack(addr, is_secure)) {
+        entry->late++;
+    }
+}
+
+void
+PCTable::prefetchUnused(Addr addr, bool is_secure)
+{
+    if (PCEntry *entry = untrack(addr, is_secure)) {
+        entry->unused++;
+    }
+}
+
+void
+PCTable::prefetchDropped(Addr addr, bool is_secure)
+{
+    untrack(addr, is_secure);
+}
+
+std::vector<const PCTable::PCEntry *>
+PCTable::ranked() const
+{
+    std::vector<const PCEntry *> entries;
+    entries.reserve(pcs.size());
+    for (const auto &entry : pcs) {
+        entries.push_back(&entry);
+    }
+    std::stable_sort(entries.begin(), entries.end(),
+        [](const PCEntry *a, const PCEntry *b)
+        { return a->ranksAbove(*b); });
+    return entries;
+}
+
+void
+PCTable::resetCounts()
+{
+    for (auto &entry : pcs) {
+        entry.issued = 0;
+        entry.useful = 0;
+        entry.late = 0;
+        entry.unused = 0;
+    }
+}
+
+} // namespace prefetch
+} // namespace gem5
@@ -0,0 +1,187 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of the table of PCs accounted by the per-PC prefetch stats.
+ */
+
+#ifndef __MEM_CACHE_PREFETCH_PC_TABLE_HH__
+#define __MEM_CACHE_PREFETCH_PC_TABLE_HH__
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+namespace prefetch
+{
+
+/**
+ * Counts the fate of the prefetches of a prefetcher per PC of the access
+ * that triggered them.
+ *
+ * Only a bounded number of PCs is accounted. They are selected with the
+ * Space-Saving algorithm: every PC has an estimate of the number of
+ * prefetches it issued, and when the table is full, the PC with the
+ * lowest estimate is replaced by the new one, which inherits that
+ * estimate plus one. The estimate of a PC exceeds its actual count by at
+ * most the estimate it inherited, and the table converges to the PCs that
+ * issue the most prefetches. The estimates rank the PCs, and are kept
+ * when the counts are reset.
+ *
+ * The fate of a prefetch is only known when its block is used or evicted,
+ * so the PC of the prefetched blocks is recorded in a direct-mapped table
+ * indexed by block address. A prefetch whose entry is overwritten before
+ * its fate is known is only accounted as issued, which samples the blocks
+ * when there are more prefetched blocks than entries.
+ */
+class PCTable
+{
+  public:
+    /** Counters of the prefetches of a PC. */
+    struct PCEntry
+    {
+        Addr pc;
+
+        /** Space-Saving estimate of the number of prefetches issued. */
+        uint64_t count;
+
+        /** Maximum overestimation of count, inherited on replacement. */
+        uint64_t error;
+
+        /**
+         * Fate of the prefetches of the PC, since it was accounted or the
+         * counts were reset.
+         */
+        uint64_t issued;
+        uint64_t useful;
+        uint64_t late;
+        uint64_t unused;
+
+        /**
+         * Whether the entry ranks above another one: it has the higher
+         * estimate, or on a tie, the higher guaranteed count.
+         */
+        bool
+        ranksAbove(const PCEntry &other) const
+        {
+            return (count != other.count) ? (count > other.count) :
+                (count - error > other.count - other.error);
+        }
+    };
+
+  private:
+    /** A prefetched block whose fate is not known yet. */
+    struct BlockEntry
+    {
+        bool valid = false;
+        bool secure = false;
+        Addr addr = 0;
+        Addr pc = 0;
+    };
+
+    /** Maximum number of PCs accounted. */
+    const std::size_t maxPCs;
+
+    /** Counters of the accounted PCs. */
+    std::vector<PCEntry> pcs;
+
+    /** Position of every accounted PC in pcs. */
+    std::unordered_map<Addr, std::size_t> pcIndex;
+
+    /** Prefetched blocks, indexed by a hash of their address. */
+    std::vector<BlockEntry> blocks;
+
+    /** Get the entry a block address maps to. */
+    BlockEntry &blockEntry(Addr addr);
+
+    /**
+     * Stop tracking a prefetched block.
+     *
+     * @param addr The address of the block.
+     * @param is_secure Whether the block is in the secure space.
+     * @return The counters of the PC that prefetched the block, or nullptr
+     *         if the block is not tracked or its PC is not accounted.
+     */
+    PCEntry *untrack(Addr addr, bool is_secure);
+
+  public:
+    /**
+     * @param num_pcs Maximum number of PCs accounted.
+     * @param num_blocks Number of prefetched blocks tracked at once.
+     */
+    PCTable(std::size_t num_pcs, std::size_t num_blocks);
+
+    /**
+     * A prefetch has been issued.
+     *
+     * @param addr The address of the prefetched block.
+     * @param is_secure Whether the block is in the secure space.
+     * @param pc The PC of the access that triggered the prefetch.
+     */
+    void prefetchIssued(Addr addr, bool is_secure, Addr pc);
+
+    /** A demand has used a prefetched block. */
+    void prefetchUseful(Addr addr, bool is_secure);
+
+    /** A demand has requested a block whose prefetch was in flight. */
+    void prefetchLate(Addr addr, bool is_secure);
+
+    /** A prefetched block has been evicted before being used. */
+    void prefetchUnused(Addr addr, bool is_secure);
+
+    /**
+     * A prefetch has been dropped because its block was already in the
+     * cache or being fetched.
+     */
+    void prefetchDropped(Addr addr, bool is_secure);
+
+    /**
+     * Get the accounted PCs, from the highest rank to the lowest.
+     */
+    std::vector<const PCEntry *> ranked() const;
+
+    /**
+     * Restart counting the fate of the prefetches. The PCs, their
+     * estimates and the prefetched blocks, whose fate is still to be
+     * accounted, are kept, so that the PCs keep their rank instead of all
+     * being replaceable at once.
+     */
+    void resetCounts();
+};
+
+} // namespace prefetch
+} // namespace gem5
+
+#endif //__MEM_CACHE_PREFETCH_PC_TABLE_HH__
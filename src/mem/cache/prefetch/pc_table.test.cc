@@ -0,0 +1,187 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "base/types.hh"
+#include "mem/cache/prefetch/pc_table.hh"
+
+using namespace gem5;
+using prefetch::PCTable;
+
+namespace
+{
+
+const Addr pcA = 0x400100;
+const Addr pcB = 0x400200;
+const Addr pcC = 0x400300;
+const Addr pcD = 0x400400;
+const Addr pcE = 0x400500;
+
+/** Issue prefetches of consecutive blocks from a PC. */
+void
+issue(PCTable &table, Addr pc, int num_prefetches, Addr first_blk = 0)
+{
+    for (int i = 0; i < num_prefetches; i++) {
+        table.prefetchIssued((first_blk + i) * 64, false, pc);
+    }
+}
+
+/** Get the PCs of the table, from the highest rank to the lowest. */
+std::vector<Addr>
+rankedPCs(const PCTable &table)
+{
+    std::vector<Addr> pcs;
+    for (const auto *entry : table.ranked()) {
+        pcs.push_back(entry->pc);
+    }
+    return pcs;
+}
+
+} // anonymous namespace
+
+/** The PCs are ranked by decreasing number of issued prefetches. */
+TEST(PCTableTest, Order)
+{
+    PCTable table(4, 64);
+    issue(table, pcA, 1);
+    issue(table, pcB, 3);
+    issue(table, pcC, 2);
+
+    EXPECT_EQ(rankedPCs(table), std::vector<Addr>({pcB, pcC, pcA}));
+    const auto entries = table.ranked();
+    EXPECT_EQ(entries[0]->issued, 3);
+    EXPECT_EQ(entries[1]->issued, 2);
+    EXPECT_EQ(entries[2]->issued, 1);
+}
+
+/**
+ * When the table is full, a new PC replaces the PC of lowest estimate and
+ * inherits it, so it ranks above it, but only its own prefetches are
+ * counted.
+ */
+TEST(PCTableTest, SpaceSaving)
+{
+    PCTable table(2, 64);
+    issue(table, pcA, 3);
+    issue(table, pcB, 1);
+
+    // C replaces B, with an estimate of 2
+    issue(table, pcC, 1);
+    ASSERT_EQ(rankedPCs(table), std::vector<Addr>({pcA, pcC}));
+    auto entries = table.ranked();
+    EXPECT_EQ(entries[1]->count, 2);
+    EXPECT_EQ(entries[1]->error, 1);
+    EXPECT_EQ(entries[1]->issued, 1);
+
+    // D replaces C, with an estimate of 3, which ties with A. A is
+    // guaranteed to have issued 3 prefetches, and D only 1, so A ranks
+    // first
+    issue(table, pcD, 1);
+    ASSERT_EQ(rankedPCs(table), std::vector<Addr>({pcA, pcD}));
+
+    // On the tie, the PC of lowest guaranteed count is replaced
+    issue(table, pcE, 1);
+    ASSERT_EQ(rankedPCs(table), std::vector<Addr>({pcE, pcA}));
+    entries = table.ranked();
+    EXPECT_EQ(entries[0]->count, 4);
+    EXPECT_EQ(entries[0]->issued, 1);
+    EXPECT_EQ(entries[1]->issued, 3);
+}
+
+/**
+ * A PC that starts issuing prefetches once the table is full is not
+ * evicted by the PCs that issue a single prefetch each in between, and
+ * ends up accounted with all its prefetches.
+ */
+TEST(PCTableTest, NoThrashing)
+{
+    PCTable table(4, 1024);
+    const Addr old_pcs[] = {pcA, pcB, pcC, pcD};
+    for (int i = 0; i < 4; i++) {
+        issue(table, old_pcs[i], 5, i * 8);
+    }
+    for (int i = 0; i < 100; i++) {
+        issue(table, pcE, 1, 64 + i);
+        issue(table, 0x500000 + i * 4, 1, 256 + i);
+    }
+
+    const auto entries = table.ranked();
+    ASSERT_EQ(entries[0]->pc, pcE);
+    EXPECT_EQ(entries[0]->issued, 100);
+    EXPECT_GE(entries[0]->count, 100);
+    EXPECT_LE(entries[0]->count - entries[0]->error, 100);
+}
+
+/** The PCs keep their rank across a reset of the counts. */
+TEST(PCTableTest, Reset)
+{
+    PCTable table(2, 64);
+    issue(table, pcA, 3);
+    issue(table, pcB, 1);
+    table.resetCounts();
+
+    // C replaces B rather than A, but A has not issued prefetches since
+    // the reset
+    issue(table, pcC, 1);
+    ASSERT_EQ(rankedPCs(table), std::vector<Addr>({pcA, pcC}));
+    const auto entries = table.ranked();
+    EXPECT_EQ(entries[0]->issued, 0);
+    EXPECT_EQ(entries[1]->issued, 1);
+}
+
+/** The fate of the prefetches is accounted to the PC that issued them. */
+TEST(PCTableTest, Fate)
+{
+    // Enough tracked blocks for the prefetched blocks not to collide
+    PCTable table(2, 4096);
+    issue(table, pcA, 4, 0);
+    issue(table, pcB, 2, 16);
+    table.prefetchUseful(0 * 64, false);
+    table.prefetchLate(1 * 64, false);
+    table.prefetchUnused(2 * 64, false);
+    table.prefetchDropped(3 * 64, false);
+    table.prefetchUseful(16 * 64, false);
+
+    // The fate of a block is only accounted once
+    table.prefetchUnused(0 * 64, false);
+
+    // Blocks of the other security space are not tracked
+    table.prefetchUseful(17 * 64, true);
+
+    ASSERT_EQ(rankedPCs(table), std::vector<Addr>({pcA, pcB}));
+    const auto entries = table.ranked();
+    EXPECT_EQ(entries[0]->useful, 1);
+    EXPECT_EQ(entries[0]->late, 1);
+    EXPECT_EQ(entries[0]->unused, 1);
+    EXPECT_EQ(entries[1]->useful, 1);
+    EXPECT_EQ(entries[1]->late, 0);
+    EXPECT_EQ(entries[1]->unused, 0);
+}
@@ -0,0 +1,354 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of a bounded priority queue of prefetch candidates.
+ */
+
+#ifndef __MEM_CACHE_PREFETCH_PREFETCH_QUEUE_HH__
+#define __MEM_CACHE_PREFETCH_PREFETCH_QUEUE_HH__
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "base/intmath.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+namespace prefetch
+{
+
+/**
+ * A fixed-capacity queue of prefetch candidates, ordered by decreasing
+ * priority. Candidates of the same priority are kept in insertion order.
+ *
+ * Entries are stored in a pool of slots that is allocated once, so their
+ * addresses are stable while they are queued (pending translations rely
+ * on it), and the order of the queue is a ring of slot numbers. Removing
+ * the head only advances the ring; other insertions and removals find
+ * their position with a binary search on the priorities and shift the
+ * slot numbers that follow it. Every entry is also chained in a hash
+ * table keyed by its address, so that looking for an address does not
+ * scan the queue.
+ *
+ * The Entry type must provide a copy constructor, a mutable int32_t
+ * priority member, and a pfInfo member with getAddr() and isSecure()
+ * methods. The address and security bit of an entry must not change
+ * while it is queued.
+ */
+template<class Entry>
+class PrefetchQueue
+{
+  private:
+    /** Raw storage of an entry. */
+    using Storage =
+        typename std::aligned_storage<sizeof(Entry), alignof(Entry)>::type;
+
+    /** Marks the end of a hash chain. */
+    static constexpr int NoSlot = -1;
+
+    /** Maximum number of entries. */
+    const std::size_t maxEntries;
+
+    /** Pool of slots holding the entries. */
+    std::vector<Storage> slots;
+
+    /** Ring of the slots of the entries, in queue order. */
+    std::vector<unsigned> order;
+
+    /** Position of the slot of each entry in the ring. */
+    std::vector<std::size_t> ringPosition;
+
+    /** Ring position of the head of the queue. */
+    std::size_t head;
+
+    /** Number of entries in the queue. */
+    std::size_t numEntries;
+
+    /** Slots that hold no entry. */
+    std::vector<unsigned> freeSlots;
+
+    /** First slot of the hash chain of each bucket. */
+    std::vector<int> buckets;
+
+    /** Next slot in the hash chain of each slot. */
+    std::vector<int> nextInChain;
+
+    /** Right shift applied to the hashed addresses to get their bucket. */
+    const unsigned hashShift;
+
+    Entry*
+    entryAt(unsigned slot)
+    {
+        return std::launder(reinterpret_cast<Entry*>(&slots[slot]));
+    }
+
+    const Entry*
+    entryAt(unsigned slot) const
+    {
+        return std::launder(reinterpret_cast<const Entry*>(&slots[slot]));
+    }
+
+    unsigned
+    slotOf(const Entry &entry) const
+    {
+        const unsigned slot =
+            reinterpret_cast<const Storage*>(&entry) - slots.data();
+        assert(slot < maxEntries);
+        return slot;
+    }
+
+    /** Get the ring position of the n-th entry of the queue. */
+    std::size_t
+    ringIndex(std::size_t n) const
+    {
+        const std::size_t index = head + n;
+        return (index >= order.size()) ? (index - order.size()) : index;
+    }
+
+    std::size_t
+    bucketOf(Addr addr, bool is_secure) const
+    {
+        return ((addr ^ Addr(is_secure)) * 0x9e3779b97f4a7c15ULL) >>
+            hashShift;
+    }
+
+    /**
+     * Get the position of the first entry whose priority is lower than
+     * the given one, which is where an entry of that priority is queued.
+     */
+    std::size_t
+    firstBelow(int64_t priority) const
+    {
+        std::size_t low = 0;
+        std::size_t high = numEntries;
+        while (low < high) {
+            const std::size_t mid = (low + high) / 2;
+            if ((*this)[mid].priority >= priority) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        return low;
+    }
+
+    /** Place a slot at a position of the queue. */
+    void
+    link(std::size_t n, unsigned slot)
+    {
+        for (std::size_t i = numEntries; i > n; i--) {
+            const std::size_t to = ringIndex(i);
+            order[to] = order[ringIndex(i - 1)];
+            ringPosition[order[to]] = to;
+        }
+        const std::size_t index = ringIndex(n);
+        order[index] = slot;
+        ringPosition[slot] = index;
+        numEntries++;
+    }
+
+    /** Remove a slot from the queue order. */
+    void
+    unlink(unsigned slot)
+    {
+        std::size_t n = ringPosition[slot] + order.size() - head;
+        if (n >= order.size()) {
+            n -= order.size();
+        }
+        assert(n < numEntries);
+        if (n == 0) {
+            head = ringIndex(1);
+        } else {
+            for (std::size_t i = n + 1; i < numEntries; i++) {
+                const std::size_t to = ringIndex(i - 1);
+                order[to] = order[ringIndex(i)];
+                ringPosition[order[to]] = to;
+            }
+        }
+        numEntries--;
+    }
+
+  public:
+    /**
+     * @param max_entries The maximum number of entries of the queue.
+     */
+    PrefetchQueue(std::size_t max_entries)
+      : maxEntries(max_entries), slots(max_entries),
+        order(std::max<std::size_t>(max_entries, 1)),
+        ringPosition(max_entries), head(0), numEntries(0),
+        buckets(std::size_t(1) << ceilLog2(2 * order.size()), NoSlot),
+        nextInChain(max_entries, NoSlot),
+        hashShift(64 - floorLog2(buckets.size()))
+    {
+        freeSlots.reserve(maxEntries);
+        for (std::size_t slot = maxEntries; slot > 0; slot--) {
+            freeSlots.push_back(slot - 1);
+        }
+    }
+
+    ~PrefetchQueue()
+    {
+        for (std::size_t n = 0; n < numEntries; n++) {
+            (*this)[n].~Entry();
+        }
+    }
+
+    PrefetchQueue(const PrefetchQueue &) = delete;
+    PrefetchQueue &operator=(const PrefetchQueue &) = delete;
+
+    std::size_t size() const { return numEntries; }
+
+    bool empty() const { return numEntries == 0; }
+
+    bool full() const { return numEntries == maxEntries; }
+
+    /** Get the n-th entry of the queue. */
+    Entry&
+    operator[](std::size_t n)
+    {
+        assert(n < numEntries);
+        return *entryAt(order[ringIndex(n)]);
+    }
+
+    const Entry&
+    operator[](std::size_t n) const
+    {
+        assert(n < numEntries);
+        return *entryAt(order[ringIndex(n)]);
+    }
+
+    /** Get the entry with the highest priority, the oldest one on ties. */
+    Entry& front() { return (*this)[0]; }
+    const Entry& front() const { return (*this)[0]; }
+
+    /**
+     * Get the oldest of the entries with the lowest priority, which is the
+     * one dropped to make room when the queue is full.
+     */
+    Entry&
+    lowestPriority()
+    {
+        assert(numEntries > 0);
+        return (*this)[firstBelow(
+            int64_t((*this)[numEntries - 1].priority) + 1)];
+    }
+
+    /**
+     * Look for an entry with the given address.
+     *
+     * @param addr The address of the entry.
+     * @param is_secure Whether the address is in the secure space.
+     * @return An entry with that address, or nullptr if there is none.
+     */
+    Entry*
+    find(Addr addr, bool is_secure)
+    {
+        for (int slot = buckets[bucketOf(addr, is_secure)]; slot != NoSlot;
+             slot = nextInChain[slot]) {
+            Entry *entry = entryAt(slot);
+            if ((entry->pfInfo.getAddr() == addr) &&
+                (entry->pfInfo.isSecure() == is_secure)) {
+                return entry;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * Queue a copy of an entry after the entries of the same or higher
+     * priority. The queue must not be full.
+     *
+     * @param entry The entry to copy.
+     * @return The queued entry.
+     */
+    Entry&
+    push(const Entry &entry)
+    {
+        assert(!full());
+        const unsigned slot = freeSlots.back();
+        freeSlots.pop_back();
+        Entry *new_entry = new (&slots[slot]) Entry(entry);
+
+        const std::size_t bucket =
+            bucketOf(entry.pfInfo.getAddr(), entry.pfInfo.isSecure());
+        nextInChain[slot] = buckets[bucket];
+        buckets[bucket] = slot;
+
+        link(firstBelow(entry.priority), slot);
+        return *new_entry;
+    }
+
+    /** Remove and destroy an entry of the queue. */
+    void
+    erase(Entry &entry)
+    {
+        const unsigned slot = slotOf(entry);
+        unlink(slot);
+
+        int *prev = &buckets[bucketOf(entry.pfInfo.getAddr(),
+                                      entry.pfInfo.isSecure())];
+        while (*prev != int(slot)) {
+            assert(*prev != NoSlot);
+            prev = &nextInChain[*prev];
+        }
+        *prev = nextInChain[slot];
+
+        entry.~Entry();
+        freeSlots.push_back(slot);
+    }
+
+    /** Remove and destroy the head of the queue. */
+    void popFront() { erase(front()); }
+
+    /**
+     * Change the priority of an entry. It is moved after the entries of
+     * the same or higher priority, as if it had just been queued.
+     */
+    void
+    updatePriority(Entry &entry, int32_t priority)
+    {
+        const unsigned slot = slotOf(entry);
+        unlink(slot);
+        entry.priority = priority;
+        link(firstBelow(priority), slot);
+    }
+};
+
+} // namespace prefetch
+} // namespace gem5
+
+#endif //__MEM_CACHE_PREFETCH_PREFETCH_QUEUE_HH__
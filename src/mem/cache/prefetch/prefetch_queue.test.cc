@@ -0,0 +1,238 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <random>
+
+#include "mem/cache/prefetch/prefetch_queue.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+struct TestInfo
+{
+    Addr addr;
+    bool secure;
+
+    Addr getAddr() const { return addr; }
+    bool isSecure() const { return secure; }
+};
+
+struct TestEntry
+{
+    TestInfo pfInfo;
+    int32_t priority;
+    /** Counts the live copies of the entries, to check their lifetime. */
+    std::shared_ptr<int> token;
+};
+
+/**
+ * A straightforward model of the queue: a list sorted by decreasing
+ * priority, in which entries are queued after the entries of the same or
+ * higher priority.
+ */
+class ReferenceQueue
+{
+  public:
+    std::list<TestEntry> entries;
+
+    void
+    push(const TestEntry &entry)
+    {
+        auto it = entries.begin();
+        while (it != entries.end() && it->priority >= entry.priority) {
+            it++;
+        }
+        entries.insert(it, entry);
+    }
+
+    std::list<TestEntry>::iterator
+    find(Addr addr, bool is_secure)
+    {
+        for (auto it = entries.begin(); it != entries.end(); it++) {
+            if (it->pfInfo.addr == addr && it->pfInfo.secure == is_secure) {
+                return it;
+            }
+        }
+        return entries.end();
+    }
+
+    std::list<TestEntry>::iterator
+    lowestPriority()
+    {
+        auto it = std::prev(entries.end());
+        while (it != entries.begin() &&
+               std::prev(it)->priority == it->priority) {
+            it--;
+        }
+        return it;
+    }
+};
+
+void
+checkSameOrder(prefetch::PrefetchQueue<TestEntry> &queue,
+               const ReferenceQueue &reference)
+{
+    ASSERT_EQ(queue.size(), reference.entries.size());
+    std::size_t pos = 0;
+    for (const auto &entry : reference.entries) {
+        ASSERT_EQ(queue[pos].pfInfo.addr, entry.pfInfo.addr);
+        ASSERT_EQ(queue[pos].pfInfo.secure, entry.pfInfo.secure);
+        ASSERT_EQ(queue[pos].priority, entry.priority);
+        pos++;
+    }
+}
+
+} // anonymous namespace
+
+TEST(PrefetchQueueTest, Empty)
+{
+    prefetch::PrefetchQueue<TestEntry> queue(4);
+    ASSERT_TRUE(queue.empty());
+    ASSERT_FALSE(queue.full());
+    ASSERT_EQ(queue.find(0x40, false), nullptr);
+}
+
+TEST(PrefetchQueueTest, PriorityOrder)
+{
+    prefetch::PrefetchQueue<TestEntry> queue(8);
+    queue.push({{0x00, false}, 1, nullptr});
+    queue.push({{0x40, false}, 3, nullptr});
+    queue.push({{0x80, false}, 1, nullptr});
+    queue.push({{0xc0, false}, 2, nullptr});
+    queue.push({{0x100, false}, 3, nullptr});
+
+    const Addr expected[] = {0x40, 0x100, 0xc0, 0x00, 0x80};
+    for (std::size_t pos = 0; pos < 5; pos++) {
+        ASSERT_EQ(queue[pos].pfInfo.addr, expected[pos]);
+    }
+    ASSERT_EQ(queue.lowestPriority().pfInfo.addr, 0x00);
+
+    // The secure bit is part of the address
+    ASSERT_EQ(queue.find(0xc0, true), nullptr);
+    ASSERT_EQ(queue.find(0xc0, false)->priority, 2);
+
+    // A raised priority moves the entry after its new equals
+    queue.updatePriority(*queue.find(0x80, false), 3);
+    ASSERT_EQ(queue[2].pfInfo.addr, 0x80);
+    ASSERT_EQ(queue.lowestPriority().pfInfo.addr, 0x00);
+
+    queue.popFront();
+    ASSERT_EQ(queue.front().pfInfo.addr, 0x100);
+    ASSERT_EQ(queue.find(0x40, false), nullptr);
+}
+
+TEST(PrefetchQueueTest, Random)
+{
+    const std::size_t capacity = 16;
+    std::mt19937 gen(1);
+    auto token = std::make_shared<int>(0);
+    {
+        prefetch::PrefetchQueue<TestEntry> queue(capacity);
+        ReferenceQueue reference;
+        for (int iter = 0; iter < 20000; iter++) {
+            // A small set of addresses makes duplicates common
+            const Addr addr = (gen() % 24) * 64;
+            const bool secure = gen() % 4 == 0;
+            const int32_t priority = int32_t(gen() % 5) - 2;
+
+            switch (gen() % 8) {
+              case 0:
+                if (!reference.entries.empty()) {
+                    queue.popFront();
+                    reference.entries.pop_front();
+                }
+                break;
+              case 1:
+                if (queue.find(addr, secure)) {
+                    queue.erase(*queue.find(addr, secure));
+                    reference.entries.erase(reference.find(addr, secure));
+                }
+                break;
+              default:
+                // Keep a single entry per address, as the queue filter of
+                // the prefetchers does
+                if (TestEntry *entry = queue.find(addr, secure)) {
+                    auto it = reference.find(addr, secure);
+                    ASSERT_NE(it, reference.entries.end());
+                    if (entry->priority < priority) {
+                        queue.updatePriority(*entry, priority);
+                        reference.entries.erase(it);
+                        reference.push({{addr, secure}, priority, nullptr});
+                    }
+                    break;
+                }
+                ASSERT_EQ(reference.find(addr, secure),
+                          reference.entries.end());
+                if (queue.full()) {
+                    TestEntry &victim = queue.lowestPriority();
+                    auto it = reference.lowestPriority();
+                    ASSERT_EQ(victim.pfInfo.addr, it->pfInfo.addr);
+                    ASSERT_EQ(victim.pfInfo.secure, it->pfInfo.secure);
+                    queue.erase(victim);
+                    reference.entries.erase(it);
+                }
+                queue.push({{addr, secure}, priority, token});
+                reference.push({{addr, secure}, priority, nullptr});
+                break;
+            }
+            checkSameOrder(queue, reference);
+            ASSERT_EQ(token.use_count(), 1 + queue.size());
+        }
+    }
+
+    // Destroying the queue destroys its entries
+    ASSERT_EQ(token.use_count(), 1);
+}
+
+TEST(PrefetchQueueTest, Duplicates)
+{
+    // Without a queue filter several entries may share an address, and
+    // they can all be found and removed
+    prefetch::PrefetchQueue<TestEntry> queue(4);
+    queue.push({{0x40, false}, 0, nullptr});
+    queue.push({{0x80, false}, 0, nullptr});
+    queue.push({{0x40, false}, 1, nullptr});
+    queue.push({{0x40, false}, 0, nullptr});
+    ASSERT_TRUE(queue.full());
+
+    int removed = 0;
+    while (TestEntry *entry = queue.find(0x40, false)) {
+        queue.erase(*entry);
+        removed++;
+    }
+    ASSERT_EQ(removed, 3);
+    ASSERT_EQ(queue.size(), 1);
+    ASSERT_EQ(queue.front().pfInfo.addr, 0x80);
+}
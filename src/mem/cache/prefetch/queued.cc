@@ -37,6 +37,7 @@
 
 #include "mem/cache/prefetch/queued.hh"
 
+#include <algorithm>
 #include <cassert>
 
 #include "arch/generic/tlb.hh"
@@ -45,6 +46,7 @@
 #include "debug/HWPrefetch.hh"
 #include "debug/HWPrefetchQueue.hh"
 #include "mem/cache/base.hh"
+#include "mem/cache/prefetch/feedback_controller.hh"
 #include "mem/request.hh"
 #include "params/QueuedPrefetcher.hh"
 
@@ -99,28 +101,29 @@ Queued::DeferredPacket::finish(const Fault &fault,
 }
 
 Queued::Queued(const QueuedPrefetcherParams &p)
-    : Base(p), queueSize(p.queue_size),
+    : Base(p), pfq(p.queue_size), pfqMissingTranslation(p.queue_size),
+      queueSize(p.queue_size),
       missingTranslationQueueSize(
         p.max_prefetch_requests_with_pending_translation),
       latency(p.latency), queueSquash(p.queue_squash),
       queueFilter(p.queue_filter), cacheSnoop(p.cache_snoop),
       tagPrefetch(p.tag_prefetch),
-      throttleControlPct(p.throttle_control_percentage), statsQueued(this)
+      throttleControlPct(p.throttle_control_percentage),
+      feedback(p.feedback), statsQueued(this)
 {
 }
 
 Queued::~Queued()
 {
     // Delete the queued prefetch packets
-    for (DeferredPacket &p : pfq) {
-        delete p.pkt;
+    for (std::size_t pos = 0; pos < pfq.size(); pos++) {
+        delete pfq[pos].pkt;
     }
 }
 
 void
-Queued::printQueue(const std::list<DeferredPacket> &queue) const
+Queued::printQueue(const DeferredQueue &queue) const
 {
-    int pos = 0;
     std::string queue_name = "";
     if (&queue == &pfq) {
         queue_name = "PFQ";
@@ -129,13 +132,13 @@ Queued::printQueue(const std::list<DeferredPacket> &queue) const
         queue_name = "PFTransQ";
     }
 
-    for (const_iterator it = queue.cbegin(); it != queue.cend();
-                                                            it++, pos++) {
-        Addr vaddr = it->pfInfo.getAddr();
+    for (std::size_t pos = 0; pos < queue.size(); pos++) {
+        const DeferredPacket &dp = queue[pos];
+        Addr vaddr = dp.pfInfo.getAddr();
         /* Set paddr to 0 if not yet translated */
-        Addr paddr = it->pkt ? it->pkt->getAddr() : 0;
+        Addr paddr = dp.pkt ? dp.pkt->getAddr() : 0;
         DPRINTF(HWPrefetchQueue, "%s[%d]: Prefetch Req VA: %#x PA: %#x "
-                "prio: %3d\n", queue_name, pos, vaddr, paddr, it->priority);
+                "prio: %3d\n", queue_name, pos, vaddr, paddr, dp.priority);
     }
 }
 
@@ -169,28 +172,47 @@ Queued::getMaxPermittedPrefetches(size_t total) const
     return max_pfs;
 }
 
+std::pair<int, int>
+Queued::prefetchRange(int degree) const
+{
+    if (!feedback) {
+        return std::make_pair(1, degree);
+    }
+    const int distance = feedback->distance();
+    return std::make_pair(distance - int(feedback->degree()) + 1, distance);
+}
+
+void
+Queued::notifyPrefetchEviction(Addr addr, bool is_secure)
+{
+    if (feedback) {
+        feedback->notifyEviction(addr, is_secure);
+    }
+}
+
 void
 Queued::notify(const PacketPtr &pkt, const PrefetchInfo &pfi)
 {
     Addr blk_addr = blockAddress(pfi.getAddr());
     bool is_secure = pfi.isSecure();
 
+    // Adjust the aggressiveness at the end of every feedback interval
+    if (feedback &&
+        feedback->notifyAccess(blk_addr, is_secure, pfi.isCacheMiss())) {
+        feedback->update(issuedPrefetches, usefulPrefetches,
+                         latePrefetches);
+    }
+
     // Squash queued prefetches if demand miss to same line
     if (queueSquash) {
-        auto itr = pfq.begin();
-        while (itr != pfq.end()) {
-            if (itr->pfInfo.getAddr() == blk_addr &&
-                itr->pfInfo.isSecure() == is_secure) {
-                DPRINTF(HWPrefetch, "Removing pf candidate addr: %#x "
-                        "(cl: %#x), demand request going to the same addr\n",
-                        itr->pfInfo.getAddr(),
-                        blockAddress(itr->pfInfo.getAddr()));
-                delete itr->pkt;
-                itr = pfq.erase(itr);
-                statsQueued.pfRemovedDemand++;
-            } else {
-                ++itr;
-            }
+        while (DeferredPacket *dp = pfq.find(blk_addr, is_secure)) {
+            DPRINTF(HWPrefetch, "Removing pf candidate addr: %#x "
+                    "(cl: %#x), demand request going to the same addr\n",
+                    dp->pfInfo.getAddr(),
+                    blockAddress(dp->pfInfo.getAddr()));
+            delete dp->pkt;
+            pfq.erase(*dp);
+            statsQueued.pfRemovedDemand++;
         }
     }
 
@@ -200,6 +222,9 @@ Queued::notify(const PacketPtr &pkt, const PrefetchInfo &pfi)
 
     // Get the maximu number of prefetches that we are allowed to generate
     size_t max_pfs = getMaxPermittedPrefetches(addresses.size());
+    if (feedback) {
+        max_pfs = std::min<size_t>(max_pfs, feedback->degree());
+    }
 
     // Queue up generated prefetches
     size_t num_pfs = 0;
@@ -250,8 +275,15 @@ Queued::getPacket()
         return nullptr;
     }
 
-    PacketPtr pkt = pfq.front().pkt;
-    pfq.pop_front();
+    const DeferredPacket &dp = pfq.front();
+    PacketPtr pkt = dp.pkt;
+    // Let the caches know how confident the prefetcher is about it
+    pkt->req->setPrefetchPriority(dp.priority);
+    if (pcStats && dp.pfInfo.hasPC()) {
+        pcStats->prefetchIssued(pkt->getAddr(), pkt->isSecure(),
+                                dp.pfInfo.getPC());
+    }
+    pfq.popFront();
 
     prefetchStats.pfIssued++;
     issuedPrefetches += 1;
@@ -287,13 +319,15 @@ void
 Queued::processMissingTranslations(unsigned max)
 {
     unsigned count = 0;
-    iterator it = pfqMissingTranslation.begin();
-    while (it != pfqMissingTranslation.end() && count < max) {
-        DeferredPacket &dp = *it;
-        // Increase the iterator first because dp.startTranslation can end up
-        // calling finishTranslation, which will erase "it"
-        it++;
-        dp.startTranslation(tlb);
+    std::size_t pos = 0;
+    while (pos < pfqMissingTranslation.size() && count < max) {
+        const std::size_t size = pfqMissingTranslation.size();
+        // dp.startTranslation can end up calling finishTranslation, which
+        // will erase dp; the next packet then takes its position
+        pfqMissingTranslation[pos].startTranslation(tlb);
+        if (pfqMissingTranslation.size() == size) {
+            pos++;
+        }
         count += 1;
     }
 }
@@ -301,65 +335,45 @@ Queued::processMissingTranslations(unsigned max)
 void
 Queued::translationComplete(DeferredPacket *dp, bool failed)
 {
-    auto it = pfqMissingTranslation.begin();
-    while (it != pfqMissingTranslation.end()) {
-        if (&(*it) == dp) {
-            break;
-        }
-        it++;
-    }
-    assert(it != pfqMissingTranslation.end());
     if (!failed) {
         DPRINTF(HWPrefetch, "%s Translation of vaddr %#x succeeded: "
                 "paddr %#x \n", tlb->name(),
-                it->translationRequest->getVaddr(),
-                it->translationRequest->getPaddr());
-        Addr target_paddr = it->translationRequest->getPaddr();
+                dp->translationRequest->getVaddr(),
+                dp->translationRequest->getPaddr());
+        Addr target_paddr = dp->translationRequest->getPaddr();
         // check if this prefetch is already redundant
-        if (cacheSnoop && (inCache(target_paddr, it->pfInfo.isSecure()) ||
-                    inMissQueue(target_paddr, it->pfInfo.isSecure()))) {
+        if (cacheSnoop && (inCache(target_paddr, dp->pfInfo.isSecure()) ||
+                    inMissQueue(target_paddr, dp->pfInfo.isSecure()))) {
             statsQueued.pfInCache++;
             DPRINTF(HWPrefetch, "Dropping redundant in "
                     "cache/MSHR prefetch addr:%#x\n", target_paddr);
         } else {
             Tick pf_time = curTick() + clockPeriod() * latency;
-            it->createPkt(target_paddr, blkSize, requestorId, tagPrefetch,
+            dp->createPkt(target_paddr, blkSize, requestorId, tagPrefetch,
                           pf_time);
-            addToQueue(pfq, *it);
+            addToQueue(pfq, *dp);
         }
     } else {
         DPRINTF(HWPrefetch, "%s Translation of vaddr %#x failed, dropping "
                 "prefetch request %#x \n", tlb->name(),
-                it->translationRequest->getVaddr());
+                dp->translationRequest->getVaddr());
     }
-    pfqMissingTranslation.erase(it);
+    pfqMissingTranslation.erase(*dp);
 }
 
 bool
-Queued::alreadyInQueue(std::list<DeferredPacket> &queue,
-                                 const PrefetchInfo &pfi, int32_t priority)
+Queued::alreadyInQueue(DeferredQueue &queue, const PrefetchInfo &pfi,
+                       int32_t priority)
 {
-    bool found = false;
-    iterator it;
-    for (it = queue.begin(); it != queue.end() && !found; it++) {
-        found = it->pfInfo.sameAddr(pfi);
-    }
+    DeferredPacket *dp = queue.find(pfi.getAddr(), pfi.isSecure());
+    bool found = dp != nullptr;
 
     /* If the address is already in the queue, update priority and leave */
-    if (it != queue.end()) {
+    if (found) {
         statsQueued.pfBufferHit++;
-        if (it->priority < priority) {
+        if (dp->priority < priority) {
             /* Update priority value and position in the queue */
-            it->priority = priority;
-            iterator prev = it;
-            while (prev != queue.begin()) {
-                prev--;
-                /* If the packet has higher priority, swap */
-                if (*it > *prev) {
-                    std::swap(*it, *prev);
-                    it = prev;
-                }
-            }
+            queue.updatePriority(*dp, priority);
             DPRINTF(HWPrefetch, "Prefetch addr already in "
                 "prefetch queue, priority updated\n");
         } else {
@@ -481,50 +495,24 @@ Queued::insert(const PacketPtr &pkt, PrefetchInfo &new_pfi,
 }
 
 void
-Queued::addToQueue(std::list<DeferredPacket> &queue,
-                             DeferredPacket &dpp)
+Queued::addToQueue(DeferredQueue &queue, DeferredPacket &dpp)
 {
     /* Verify prefetch buffer space for request */
     if (queue.size() == queueSize) {
         statsQueued.pfRemovedFull++;
-        /* Lowest priority packet */
-        iterator it = queue.end();
-        panic_if (it == queue.begin(),
-            "Prefetch queue is both full and empty!");
-        --it;
-        /* Look for oldest in that level of priority */
-        panic_if (it == queue.begin(),
+        panic_if (queue.empty(), "Prefetch queue is both full and empty!");
+        panic_if (queue.size() == 1,
             "Prefetch queue is full with 1 element!");
-        iterator prev = it;
-        bool cont = true;
-        /* While not at the head of the queue */
-        while (cont && prev != queue.begin()) {
-            prev--;
-            /* While at the same level of priority */
-            cont = prev->priority == it->priority;
-            if (cont)
-                /* update pointer */
-                it = prev;
-        }
+        /* Oldest packet of the lowest level of priority */
+        DeferredPacket &victim = queue.lowestPriority();
         DPRINTF(HWPrefetch, "Prefetch queue full, removing lowest priority "
-                            "oldest packet, addr: %#x\n",it->pfInfo.getAddr());
-        delete it->pkt;
-        queue.erase(it);
+                "oldest packet, addr: %#x\n", victim.pfInfo.getAddr());
+        delete victim.pkt;
+        queue.erase(victim);
     }
 
-    if ((queue.size() == 0) || (dpp <= queue.back())) {
-        queue.emplace_back(dpp);
-    } else {
-        iterator it = queue.end();
-        do {
-            --it;
-        } while (it != queue.begin() && dpp > *it);
-        /* If we reach the head, we have to see if the new element is new head
-         * or not */
-        if (it == queue.begin() && dpp <= *it)
-            it++;
-        queue.insert(it, dpp);
-    }
+    /* Queue it after the packets of the same or higher priority */
+    queue.push(dpp);
 
     if (debug::HWPrefetchQueue)
         printQueue(queue);
@@ -39,13 +39,13 @@
 #define __MEM_CACHE_PREFETCH_QUEUED_HH__
 
 #include <cstdint>
-#include <list>
 #include <utility>
 
 #include "arch/generic/mmu.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "mem/cache/prefetch/base.hh"
+#include "mem/cache/prefetch/prefetch_queue.hh"
 #include "mem/packet.hh"
 
 namespace gem5
@@ -57,6 +57,8 @@ GEM5_DEPRECATED_NAMESPACE(Prefetcher, prefetch);
 namespace prefetch
 {
 
+class FeedbackController;
+
 class Queued : public Base
 {
   protected:
@@ -140,11 +142,10 @@ class Queued : public Base
         void startTranslation(BaseTLB *tlb);
     };
 
-    std::list<DeferredPacket> pfq;
-    std::list<DeferredPacket> pfqMissingTranslation;
+    using DeferredQueue = PrefetchQueue<DeferredPacket>;
 
-    using const_iterator = std::list<DeferredPacket>::const_iterator;
-    using iterator = std::list<DeferredPacket>::iterator;
+    DeferredQueue pfq;
+    DeferredQueue pfqMissingTranslation;
 
     // PARAMETERS
 
@@ -175,6 +176,20 @@ class Queued : public Base
     /** Percentage of requests that can be throttled */
     const unsigned int throttleControlPct;
 
+    /** Controller adjusting the aggressiveness of the prefetcher, if any */
+    FeedbackController *const feedback;
+
+    /**
+     * Get the range of prefetches to generate for an access, as distances
+     * in number of prefetches ahead of it. Without a feedback controller
+     * the range is [1, degree]; otherwise the controller decides both how
+     * many prefetches to generate and how far ahead.
+     *
+     * @param degree Number of prefetches to generate by default.
+     * @return The first and last distance of the range.
+     */
+    std::pair<int, int> prefetchRange(int degree) const;
+
     struct QueuedStats : public statistics::Group
     {
         QueuedStats(statistics::Group *parent);
@@ -195,6 +210,8 @@ class Queued : public Base
 
     void notify(const PacketPtr &pkt, const PrefetchInfo &pfi) override;
 
+    void notifyPrefetchEviction(Addr addr, bool is_secure) override;
+
     void insert(const PacketPtr &pkt, PrefetchInfo &new_pfi, int32_t priority);
 
     virtual void calculatePrefetch(const PrefetchInfo &pfi,
@@ -206,7 +223,7 @@ class Queued : public Base
         return pfq.empty() ? MaxTick : pfq.front().tick;
     }
 
-    void printQueue(const std::list<DeferredPacket> &queue) const;
+    void printQueue(const DeferredQueue &queue) const;
 
   private:
 
@@ -215,7 +232,7 @@ class Queued : public Base
      * @param queue selected queue to use
      * @param dpp DeferredPacket to add
      */
-    void addToQueue(std::list<DeferredPacket> &queue, DeferredPacket &dpp);
+    void addToQueue(DeferredQueue &queue, DeferredPacket &dpp);
 
     /**
      * Starts the translations of the queued prefetches with a
@@ -243,8 +260,8 @@ class Queued : public Base
      * @param priority priority of the prefetch request to be added
      * @return True if the prefetch request was found in the queue
      */
-    bool alreadyInQueue(std::list<DeferredPacket> &queue,
-                        const PrefetchInfo &pfi, int32_t priority);
+    bool alreadyInQueue(DeferredQueue &queue, const PrefetchInfo &pfi,
+                        int32_t priority);
 
     /**
      * Returns the maxmimum number of prefetch requests that are allowed
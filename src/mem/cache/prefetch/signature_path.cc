@@ -131,8 +131,10 @@ SignaturePath::addPrefetch(Addr ppn, stride_t last_block,
     Addr new_addr = pf_ppn * pageBytes;
     new_addr += pf_block * (Addr)blkSize;
 
+    // The confidence of the path, as a percentage, is the priority of the
+    // prefetch
     DPRINTF(HWPrefetch, "Queuing prefetch to %#x.\n", new_addr);
-    addresses.push_back(AddrPriority(new_addr, 0));
+    addresses.push_back(AddrPriority(new_addr, path_confidence * 100));
 }
 
 void
@@ -58,11 +58,9 @@ SignaturePathV2::handleSignatureTableMiss(stride_t current_block,
     bool found = false;
 
     // This should return all entries of the GHR, since it is a fully
-    // associative table
-    std::vector<GlobalHistoryEntry *> all_ghr_entries =
-             globalHistoryRegister.getPossibleEntries(0 /* any value works */);
-
-    for (auto gh_entry : all_ghr_entries) {
+    // associative table, so any key works
+    for (GlobalHistoryEntry *gh_entry :
+            globalHistoryRegister.getPossibleEntries(0)) {
         if (gh_entry->lastBlock + gh_entry->delta == current_block) {
             new_signature = gh_entry->signature;
             new_conf = gh_entry->confidence;
@@ -169,7 +169,8 @@ Stride::calculatePrefetch(const PrefetchInfo &pfi,
         }
 
         // Generate up to degree prefetches
-        for (int d = 1; d <= degree; d++) {
+        const auto [first, last] = prefetchRange(degree);
+        for (int d = first; d <= last; d++) {
             // Round strides up to atleast 1 cacheline
             int prefetch_stride = new_stride;
             if (abs(new_stride) < blkSize) {
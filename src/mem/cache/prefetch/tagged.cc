@@ -54,7 +54,8 @@ Tagged::calculatePrefetch(const PrefetchInfo &pfi,
 {
     Addr blkAddr = blockAddress(pfi.getAddr());
 
-    for (int d = 1; d <= degree; d++) {
+    const auto [first, last] = prefetchRange(degree);
+    for (int d = first; d <= last; d++) {
         Addr newAddr = blkAddr + d*(blkSize);
         addresses.push_back(AddrPriority(newAddr,0));
     }
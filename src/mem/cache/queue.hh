@@ -48,7 +48,9 @@
 #include <cassert>
 #include <string>
 #include <type_traits>
+#include <vector>
 
+#include "base/intmath.hh"
 #include "base/logging.hh"
 #include "base/named.hh"
 #include "base/trace.hh"
@@ -101,6 +103,75 @@ class Queue : public Drainable, public Named
     /** Holds non allocated entries. */
     typename Entry::List freeList;
 
+    /** Right shift applied to hashed block addresses to get a bucket. */
+    const unsigned matchShift;
+
+    /**
+     * First and last allocated entries of the chains of entries whose
+     * block addresses hash to the same bucket. Entries are appended to
+     * the chains when they are allocated, so each chain follows the order
+     * of the allocatedList, and searching a chain finds the same entry as
+     * searching the whole allocatedList would.
+     */
+    std::vector<Entry*> matchHeads;
+    std::vector<Entry*> matchTails;
+
+    /** Get the bucket of the chain holding entries of a block address. */
+    std::size_t
+    matchBucket(Addr blk_addr) const
+    {
+        return (blk_addr * 0x9e3779b97f4a7c15ULL) >> matchShift;
+    }
+
+    /** Get the entry that follows the given one in its chain. */
+    static Entry*
+    nextInChain(const Entry *entry)
+    {
+        return static_cast<Entry*>(entry->matchNext);
+    }
+
+    /**
+     * Append a newly allocated entry to the chain of its block address.
+     * Must be called once the entry's block address is set.
+     *
+     * @param entry The entry.
+     */
+    void
+    addToMatchChain(Entry *entry)
+    {
+        const std::size_t bucket = matchBucket(entry->blkAddr);
+        entry->matchPrev = matchTails[bucket];
+        entry->matchNext = nullptr;
+        if (matchTails[bucket]) {
+            matchTails[bucket]->matchNext = entry;
+        } else {
+            matchHeads[bucket] = entry;
+        }
+        matchTails[bucket] = entry;
+    }
+
+    /**
+     * Remove an entry from the chain of its block address.
+     *
+     * @param entry The entry.
+     */
+    void
+    removeFromMatchChain(Entry *entry)
+    {
+        const std::size_t bucket = matchBucket(entry->blkAddr);
+        if (entry->matchPrev) {
+            entry->matchPrev->matchNext = entry->matchNext;
+        } else {
+            matchHeads[bucket] = static_cast<Entry*>(entry->matchNext);
+        }
+        if (entry->matchNext) {
+            entry->matchNext->matchPrev = entry->matchPrev;
+        } else {
+            matchTails[bucket] = static_cast<Entry*>(entry->matchPrev);
+        }
+        entry->matchPrev = entry->matchNext = nullptr;
+    }
+
     typename Entry::Iterator addToReadyList(Entry* entry)
     {
         if (readyList.empty() ||
@@ -135,6 +206,10 @@ class Queue : public Drainable, public Named
         Named(name),
         label(_label), numEntries(num_entries + reserve),
         numReserve(reserve), entries(numEntries, name + ".entry"),
+        // Twice as many buckets as entries keep the chains short
+        matchShift(64 - ceilLog2(2 * numEntries)),
+        matchHeads(std::size_t(1) << (64 - matchShift), nullptr),
+        matchTails(matchHeads.size(), nullptr),
         _numInService(0), allocated(0)
     {
         for (int i = 0; i < numEntries; ++i) {
@@ -168,7 +243,8 @@ class Queue : public Drainable, public Named
     Entry* findMatch(Addr blk_addr, bool is_secure,
                      bool ignore_uncacheable = true) const
     {
-        for (const auto& entry : allocatedList) {
+        for (Entry *entry = matchHeads[matchBucket(blk_addr)]; entry;
+             entry = nextInChain(entry)) {
             // we ignore any entries allocated for uncacheable
             // accesses and simply ignore them when matching, in the
             // cache we never check for matches when adding new
@@ -205,6 +281,32 @@ class Queue : public Drainable, public Named
      * @return A pointer to the earliest matching entry.
      */
     Entry* findPending(const QueueEntry* entry) const
+    {
+        // Only entries of the same block address can conflict, and the
+        // entries that are not in service are the ones in the readyList
+        Entry *pending = nullptr;
+        Entry *candidate = matchHeads[matchBucket(entry->blkAddr)];
+        for (; candidate; candidate = nextInChain(candidate)) {
+            if (!candidate->inService && candidate->conflictAddr(entry)) {
+                if (pending) {
+                    // The earliest in the readyList must be returned, so
+                    // let the readyList order the candidates
+                    return findPendingInReadyList(entry);
+                }
+                pending = candidate;
+            }
+        }
+        return pending;
+    }
+
+    /**
+     * Find the first entry of the readyList that overlaps the given
+     * request of a different queue.
+     *
+     * @param entry The entry to be compared against.
+     * @return A pointer to the earliest matching entry.
+     */
+    Entry* findPendingInReadyList(const QueueEntry* entry) const
     {
         for (const auto& ready_entry : readyList) {
             if (ready_entry->conflictAddr(entry)) {
@@ -241,6 +343,7 @@ class Queue : public Drainable, public Named
     deallocate(Entry *entry)
     {
         allocatedList.erase(entry->allocIter);
+        removeFromMatchChain(entry);
         freeList.push_front(entry);
         allocated--;
         if (entry->inService) {
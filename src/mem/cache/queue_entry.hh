@@ -76,6 +76,13 @@ class QueueEntry : public Packet::SenderState, public Named
     /** True if the entry is uncacheable */
     bool _isUncacheable;
 
+    /**
+     * Neighbours of the entry in the chain of allocated entries that hash
+     * to the same block address bucket of the queue.
+     */
+    QueueEntry *matchPrev;
+    QueueEntry *matchNext;
+
   public:
     /**
      * A queue entry is holding packets that will be serviced as soon as
@@ -124,6 +131,7 @@ class QueueEntry : public Packet::SenderState, public Named
     QueueEntry(const std::string &name)
         : Named(name),
           readyTime(0), _isUncacheable(false),
+          matchPrev(nullptr), matchNext(nullptr),
           inService(false), order(0), blkAddr(0), blkSize(0), isSecure(false)
     {}
 
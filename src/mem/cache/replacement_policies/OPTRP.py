@@ -0,0 +1,46 @@
+# Copyright (c) 2026 The gem5 Shepherd Cache authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.params import *
+from m5.proxy import *
+from m5.objects.ReplacementPolicies import BaseReplacementPolicy
+
+class OPTRP(BaseReplacementPolicy):
+    type = 'OPTRP'
+    cxx_class = 'gem5::replacement_policy::OPT'
+    cxx_header = "mem/cache/replacement_policies/opt_rp.hh"
+
+    # The trace must record the requests received by the cache, e.g. with a
+    # MemTraceProbe attached to a CommMonitor placed in front of it, in a
+    # previous run of the same workload. The whole trace is held in memory:
+    # about 12 bytes per record (its block address, the position of the
+    # next reference to the block and whether it was matched), plus one
+    # hash map entry per distinct block while the trace is loaded
+    trace_file = Param.String("Trace of the accesses to the cache")
+    block_size = Param.Int(Parent.cache_line_size,
+        "Size of the blocks the trace addresses are aligned to")
+    lookahead = Param.Unsigned(1024,
+        "Number of trace records searched to match an access")
@@ -96,6 +96,10 @@ class BRRIPRP(BaseReplacementPolicy):
         "Prioritize evicting blocks that havent had a hit recently")
     btp = Param.Percent(3,
         "Percentage of blocks to be inserted with long RRPV")
+    prefetch_priority_threshold = Param.Int(0, "Hardware prefetches whose "
+        "prefetcher gave them a lower priority are inserted with distant "
+        "RRPV. Prefetchers give priorities of 0 or more, so the default "
+        "treats prefetches as any other block")
 
 class RRIPRP(BRRIPRP):
     btp = 100
@@ -155,4 +159,28 @@ class SCRP(BaseReplacementPolicy):
     cxx_class = 'gem5::replacement_policy::SC'
     cxx_header = "mem/cache/replacement_policies/sc_rp.hh"
 
-    num_sc_ways = Param.Int(4, "Number of Shephered-Cache ways within each set")
\ No newline at end of file
+    num_sc_ways = Param.Int(4, "Number of Shephered-Cache ways within each set")
+    counter_bits = Param.Unsigned(0, "Width of the Shepherd Cache counters "
+        "(8, 16 or 32 bits), 0 to use the narrowest that fits the "
+        "associativity")
+    trace_first_set = Param.Int(0, "First set traced by the ReplacementSC "
+        "debug flag")
+    trace_last_set = Param.Int(-1, "Last set traced by the ReplacementSC "
+        "debug flag, -1 for the last set of the cache")
+    prefetch_priority_threshold = Param.Int(0, "Hardware prefetches whose "
+        "prefetcher gave them a lower priority are inserted as the next "
+        "victim of their set, without protection from the Shepherd Cache. "
+        "Prefetchers give priorities of 0 or more, so the default treats "
+        "prefetches as any other block")
+
+class DuelingSCRP(DuelingRP):
+    # Leader sets of team A always use the Shepherd Cache, those of team B
+    # always use LRU, and the follower sets use whichever has missed the
+    # least so far. Sub-policy B can be replaced by another SCRP to duel
+    # different numbers of SC ways instead. A Shepherd Cache that did not
+    # select a victim points one of its SC ways to it when it is filled,
+    # so its state stays valid whichever team a set uses. As for DRRIPRP, the
+    # constituency_size and the team_size must be manually provided, and
+    # the team_size must match the associativity.
+    replacement_policy_a = SCRP()
+    replacement_policy_b = LRURP()
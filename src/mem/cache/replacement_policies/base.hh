@@ -29,7 +29,9 @@
 #ifndef __MEM_CACHE_REPLACEMENT_POLICIES_BASE_HH__
 #define __MEM_CACHE_REPLACEMENT_POLICIES_BASE_HH__
 
+#include <cstddef>
 #include <memory>
+#include <vector>
 
 #include "base/compiler.hh"
 #include "mem/cache/replacement_policies/replaceable_entry.hh"
@@ -95,6 +97,26 @@ class Base : public SimObject
     virtual void reset(const std::shared_ptr<ReplacementData>&
         replacement_data) const = 0;
 
+  protected:
+    /**
+     * Check whether an entry is being filled by a hardware prefetch whose
+     * prefetcher gave it a priority lower than a threshold. Policies can
+     * insert such prefetches with a low priority, so that they do not
+     * displace useful entries when they turn out to be useless.
+     *
+     * @param pkt Packet that filled the entry.
+     * @param threshold Lowest priority of the confident prefetches.
+     * @return Whether the entry is filled by an unconfident prefetch.
+     */
+    static bool
+    isUnconfidentPrefetch(const PacketPtr pkt, int32_t threshold)
+    {
+        return pkt && pkt->req->hasPrefetchPriority() &&
+            (pkt->req->getPrefetchPriority() < threshold);
+    }
+
+  public:
+
     /**
      * Find replacement victim among candidates.
      *
@@ -110,6 +132,59 @@ class Base : public SimObject
      * @return A shared pointer to the new replacement data.
      */
     virtual std::shared_ptr<ReplacementData> instantiateEntry() = 0;
+
+    /**
+     * Instantiate the replacement data of all the entries of a table at
+     * once. This is also how the policy learns the geometry of the table:
+     * the entry in set s and way w is returned at position s * assoc + w,
+     * so policies that keep per-set state can size it here and map every
+     * entry to its position, whatever tag store or indexing policy owns
+     * the table. With skewed indexing a "set" is a row of the table.
+     *
+     * Policies whose entries are independent override this to place
+     * every entry in a single contiguous arena they own, instead of using
+     * one heap object and one control block per entry. The default
+     * implementation falls back to instantiateEntry(), which is needed
+     * when entries share state.
+     *
+     * @param num_sets Number of sets of the table.
+     * @param assoc Associativity of the table.
+     * @return Shared pointers to the replacement data of every entry.
+     */
+    virtual std::vector<std::shared_ptr<ReplacementData>>
+    instantiateEntries(std::size_t num_sets, std::size_t assoc)
+    {
+        std::vector<std::shared_ptr<ReplacementData>> entries(
+            num_sets * assoc);
+        for (auto& entry : entries) {
+            entry = instantiateEntry();
+        }
+        return entries;
+    }
+
+  protected:
+    /**
+     * Allocate the replacement data of num_entries entries in a single
+     * arena. All returned pointers alias the arena, so they share its
+     * control block and the arena lives as long as any of its entries.
+     *
+     * @param num_entries Number of entries to allocate.
+     * @param init_value Value every entry is initialized to.
+     * @return Shared pointers to every entry of the arena.
+     */
+    template <class T>
+    static std::vector<std::shared_ptr<ReplacementData>>
+    makeArena(std::size_t num_entries, const T& init_value = T())
+    {
+        auto arena = std::make_shared<std::vector<T>>(num_entries,
+                                                      init_value);
+        std::vector<std::shared_ptr<ReplacementData>> entries;
+        entries.reserve(num_entries);
+        for (T& entry : *arena) {
+            entries.emplace_back(arena, &entry);
+        }
+        return entries;
+    }
 };
 
 } // namespace replacement_policy
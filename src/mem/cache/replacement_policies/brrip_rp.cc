@@ -44,7 +44,7 @@ namespace replacement_policy
 
 BRRIP::BRRIP(const Params &p)
   : Base(p), numRRPVBits(p.num_bits), hitPriority(p.hit_priority),
-    btp(p.btp)
+    btp(p.btp), prefetchPriorityThreshold(p.prefetch_priority_threshold)
 {
     fatal_if(numRRPVBits <= 0, "There should be at least one bit per RRPV.\n");
 }
@@ -93,6 +93,19 @@ BRRIP::reset(const std::shared_ptr<ReplacementData>& replacement_data) const
     casted_replacement_data->valid = true;
 }
 
+void
+BRRIP::reset(const std::shared_ptr<ReplacementData>& replacement_data,
+    const PacketPtr pkt)
+{
+    reset(replacement_data);
+
+    // Unconfident prefetches are the first to be evicted if not used
+    if (isUnconfidentPrefetch(pkt, prefetchPriorityThreshold)) {
+        std::static_pointer_cast<BRRIPReplData>(
+            replacement_data)->rrpv.saturate();
+    }
+}
+
 ReplaceableEntry*
 BRRIP::getVictim(const ReplacementCandidates& candidates) const
 {
@@ -148,5 +161,12 @@ BRRIP::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new BRRIPReplData(numRRPVBits));
 }
 
+std::vector<std::shared_ptr<ReplacementData>>
+BRRIP::instantiateEntries(std::size_t num_sets, std::size_t assoc)
+{
+    return makeArena<BRRIPReplData>(num_sets * assoc,
+                                    BRRIPReplData(numRRPVBits));
+}
+
 } // namespace replacement_policy
 } // namespace gem5
@@ -52,6 +52,8 @@
 #ifndef __MEM_CACHE_REPLACEMENT_POLICIES_BRRIP_RP_HH__
 #define __MEM_CACHE_REPLACEMENT_POLICIES_BRRIP_RP_HH__
 
+#include <vector>
+
 #include "base/sat_counter.hh"
 #include "mem/cache/replacement_policies/base.hh"
 
@@ -112,6 +114,12 @@ class BRRIP : public Base
      */
     const unsigned btp;
 
+    /**
+     * Prefetches whose priority is lower than this are inserted with a
+     * distant re-reference, regardless of the insertion policy.
+     */
+    const int32_t prefetchPriorityThreshold;
+
   public:
     typedef BRRIPRPParams Params;
     BRRIP(const Params &p);
@@ -143,6 +151,16 @@ class BRRIP : public Base
     void reset(const std::shared_ptr<ReplacementData>& replacement_data) const
                                                                      override;
 
+    /**
+     * Reset replacement data. Used when an entry is inserted. Unconfident
+     * prefetches are inserted with a distant re-reference.
+     *
+     * @param replacement_data Replacement data to be reset.
+     * @param pkt Packet that generated this miss.
+     */
+    void reset(const std::shared_ptr<ReplacementData>& replacement_data,
+        const PacketPtr pkt) override;
+
     /**
      * Find replacement victim using rrpv.
      *
@@ -158,6 +176,16 @@ class BRRIP : public Base
      * @return A shared pointer to the new replacement data.
      */
     std::shared_ptr<ReplacementData> instantiateEntry() override;
+
+    /**
+     * Instantiate the replacement data of a table in a single arena.
+     *
+     * @param num_sets Number of sets of the table.
+     * @param assoc Associativity of the table.
+     * @return Shared pointers to the replacement data of every entry.
+     */
+    std::vector<std::shared_ptr<ReplacementData>>
+    instantiateEntries(std::size_t num_sets, std::size_t assoc) override;
 };
 
 } // namespace replacement_policy
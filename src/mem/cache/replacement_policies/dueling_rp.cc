@@ -182,6 +182,25 @@ Dueling::instantiateEntry()
     return std::shared_ptr<DuelerReplData>(replacement_data);
 }
 
+std::vector<std::shared_ptr<ReplacementData>>
+Dueling::instantiateEntries(std::size_t num_sets, std::size_t assoc)
+{
+    // Forward the table geometry so that the sub-policies can keep their
+    // own per-set state
+    const auto entries_a = replPolicyA->instantiateEntries(num_sets, assoc);
+    const auto entries_b = replPolicyB->instantiateEntries(num_sets, assoc);
+
+    std::vector<std::shared_ptr<ReplacementData>> entries;
+    entries.reserve(num_sets * assoc);
+    for (std::size_t i = 0; i < num_sets * assoc; i++) {
+        DuelerReplData* replacement_data =
+            new DuelerReplData(entries_a[i], entries_b[i]);
+        duelingMonitor.initEntry(static_cast<Dueler*>(replacement_data));
+        entries.emplace_back(replacement_data);
+    }
+    return entries;
+}
+
 Dueling::DuelingStats::DuelingStats(statistics::Group* parent)
   : statistics::Group(parent),
     ADD_STAT(selectedA, "Number of times A was selected to victimize"),
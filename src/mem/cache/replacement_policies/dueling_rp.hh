@@ -29,7 +29,9 @@
 #ifndef __MEM_CACHE_REPLACEMENT_POLICIES_DUELING_RP_HH__
 #define __MEM_CACHE_REPLACEMENT_POLICIES_DUELING_RP_HH__
 
+#include <cstddef>
 #include <memory>
+#include <vector>
 
 #include "base/compiler.hh"
 #include "base/statistics.hh"
@@ -111,6 +113,8 @@ class Dueling : public Base
     ReplaceableEntry* getVictim(const ReplacementCandidates& candidates) const
                                                                      override;
     std::shared_ptr<ReplacementData> instantiateEntry() override;
+    std::vector<std::shared_ptr<ReplacementData>>
+    instantiateEntries(std::size_t num_sets, std::size_t assoc) override;
 };
 
 } // namespace replacement_policy
@@ -31,6 +31,7 @@
 #include <cassert>
 #include <memory>
 
+#include "mem/cache/replacement_policies/victim_select.hh"
 #include "params/FIFORP.hh"
 #include "sim/cur_tick.hh"
 
@@ -50,8 +51,8 @@ void
 FIFO::invalidate(const std::shared_ptr<ReplacementData>& replacement_data)
 {
     // Reset insertion tick
-    std::static_pointer_cast<FIFOReplData>(
-        replacement_data)->tickInserted = Tick(0);
+    static_cast<FIFOReplData*>(replacement_data.get())->tickInserted =
+        Tick(0);
 }
 
 void
@@ -64,8 +65,8 @@ void
 FIFO::reset(const std::shared_ptr<ReplacementData>& replacement_data) const
 {
     // Set insertion tick
-    std::static_pointer_cast<FIFOReplData>(
-        replacement_data)->tickInserted = curTick();
+    static_cast<FIFOReplData*>(replacement_data.get())->tickInserted =
+        curTick();
 }
 
 ReplaceableEntry*
@@ -74,19 +75,17 @@ FIFO::getVictim(const ReplacementCandidates& candidates) const
     // There must be at least one replacement candidate
     assert(candidates.size() > 0);
 
-    // Visit all candidates to find victim
-    ReplaceableEntry* victim = candidates[0];
-    for (const auto& candidate : candidates) {
-        // Update victim entry if necessary
-        if (std::static_pointer_cast<FIFOReplData>(
-                    candidate->replacementData)->tickInserted <
-                std::static_pointer_cast<FIFOReplData>(
-                    victim->replacementData)->tickInserted) {
-            victim = candidate;
-        }
+    // Gather the timestamps of all candidates. The replacement data is
+    // accessed through raw pointers to avoid reference counting traffic.
+    candidateTicks.resize(candidates.size());
+    for (std::size_t i = 0; i < candidates.size(); i++) {
+        candidateTicks[i] = static_cast<const FIFOReplData*>(
+            candidates[i]->replacementData.get())->tickInserted;
     }
 
-    return victim;
+    // The first candidate with the oldest timestamp is the victim
+    return candidates[findFirstMin(candidateTicks.data(),
+                                   candidateTicks.size())];
 }
 
 std::shared_ptr<ReplacementData>
@@ -95,5 +94,11 @@ FIFO::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new FIFOReplData());
 }
 
+std::vector<std::shared_ptr<ReplacementData>>
+FIFO::instantiateEntries(std::size_t num_sets, std::size_t assoc)
+{
+    return makeArena<FIFOReplData>(num_sets * assoc);
+}
+
 } // namespace replacement_policy
 } // namespace gem5
@@ -93,5 +93,11 @@ LFU::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new LFUReplData());
 }
 
+std::vector<std::shared_ptr<ReplacementData>>
+LFU::instantiateEntries(std::size_t num_sets, std::size_t assoc)
+{
+    return makeArena<LFUReplData>(num_sets * assoc);
+}
+
 } // namespace replacement_policy
 } // namespace gem5
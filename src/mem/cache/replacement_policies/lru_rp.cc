@@ -31,8 +31,11 @@
 #include <cassert>
 #include <memory>
 
+#include "base/logging.hh"
+#include "mem/cache/replacement_policies/victim_select.hh"
 #include "params/LRURP.hh"
 #include "sim/cur_tick.hh"
+#include "sim/serialize.hh"
 
 namespace gem5
 {
@@ -50,24 +53,24 @@ void
 LRU::invalidate(const std::shared_ptr<ReplacementData>& replacement_data)
 {
     // Reset last touch timestamp
-    std::static_pointer_cast<LRUReplData>(
-        replacement_data)->lastTouchTick = Tick(0);
+    static_cast<LRUReplData*>(replacement_data.get())->lastTouchTick =
+        Tick(0);
 }
 
 void
 LRU::touch(const std::shared_ptr<ReplacementData>& replacement_data) const
 {
     // Update last touch timestamp
-    std::static_pointer_cast<LRUReplData>(
-        replacement_data)->lastTouchTick = curTick();
+    static_cast<LRUReplData*>(replacement_data.get())->lastTouchTick =
+        curTick();
 }
 
 void
 LRU::reset(const std::shared_ptr<ReplacementData>& replacement_data) const
 {
     // Set last touch timestamp
-    std::static_pointer_cast<LRUReplData>(
-        replacement_data)->lastTouchTick = curTick();
+    static_cast<LRUReplData*>(replacement_data.get())->lastTouchTick =
+        curTick();
 }
 
 ReplaceableEntry*
@@ -76,19 +79,17 @@ LRU::getVictim(const ReplacementCandidates& candidates) const
     // There must be at least one replacement candidate
     assert(candidates.size() > 0);
 
-    // Visit all candidates to find victim
-    ReplaceableEntry* victim = candidates[0];
-    for (const auto& candidate : candidates) {
-        // Update victim entry if necessary
-        if (std::static_pointer_cast<LRUReplData>(
-                    candidate->replacementData)->lastTouchTick <
-                std::static_pointer_cast<LRUReplData>(
-                    victim->replacementData)->lastTouchTick) {
-            victim = candidate;
-        }
+    // Gather the timestamps of all candidates. The replacement data is
+    // accessed through raw pointers to avoid reference counting traffic.
+    candidateTicks.resize(candidates.size());
+    for (std::size_t i = 0; i < candidates.size(); i++) {
+        candidateTicks[i] = static_cast<const LRUReplData*>(
+            candidates[i]->replacementData.get())->lastTouchTick;
     }
 
-    return victim;
+    // The first candidate with the oldest timestamp is the victim
+    return candidates[findFirstMin(candidateTicks.data(),
+                                   candidateTicks.size())];
 }
 
 std::shared_ptr<ReplacementData>
@@ -97,5 +98,82 @@ LRU::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new LRUReplData());
 }
 
+std::vector<std::shared_ptr<ReplacementData>>
+LRU::instantiateEntries(std::size_t num_sets, std::size_t assoc)
+{
+    auto table_entries = makeArena<LRUReplData>(num_sets * assoc);
+    std::vector<LRUReplData *> &table = tables.emplace_back();
+    table.reserve(table_entries.size());
+    for (const auto &entry : table_entries) {
+        table.push_back(static_cast<LRUReplData*>(entry.get()));
+    }
+    return table_entries;
+}
+
+void
+LRU::serialize(CheckpointOut &cp) const
+{
+    // The timestamps of all the tables are stored one after the other,
+    // and the size of every table is stored to split them
+    std::vector<uint64_t> table_sizes;
+    std::vector<Tick> last_touch_ticks;
+    for (const auto &table : tables) {
+        table_sizes.push_back(table.size());
+        for (const LRUReplData *entry : table) {
+            last_touch_ticks.push_back(entry->lastTouchTick);
+        }
+    }
+    SERIALIZE_CONTAINER(table_sizes);
+    SERIALIZE_CONTAINER(last_touch_ticks);
+}
+
+void
+LRU::unserialize(CheckpointIn &cp)
+{
+    // Checkpoints that predate the LRU state do not have it
+    if (!cp.entryExists(Serializable::currentSection(),
+                        "last_touch_ticks")) {
+        return;
+    }
+    std::vector<Tick> last_touch_ticks;
+    UNSERIALIZE_CONTAINER(last_touch_ticks);
+
+    // Checkpoints that predate shared policies hold a single table
+    std::vector<uint64_t> table_sizes;
+    if (cp.entryExists(Serializable::currentSection(), "table_sizes")) {
+        UNSERIALIZE_CONTAINER(table_sizes);
+    } else {
+        table_sizes.push_back(last_touch_ticks.size());
+    }
+
+    // Tables created on demand, such as the per-context tables of a
+    // prefetcher, may not exist yet, so the layouts can differ
+    bool matches = (table_sizes.size() == tables.size());
+    for (std::size_t i = 0; matches && i < tables.size(); i++) {
+        matches = (table_sizes[i] == tables[i].size());
+    }
+    if (!matches) {
+        warn("%s: The LRU tables of the checkpoint do not match the "
+             "current ones; ignoring them.\n", name());
+        return;
+    }
+    restoredTicks = std::move(last_touch_ticks);
+}
+
+void
+LRU::startup()
+{
+    std::size_t i = 0;
+    for (auto &table : tables) {
+        for (LRUReplData *entry : table) {
+            if (i == restoredTicks.size()) {
+                break;
+            }
+            entry->lastTouchTick = restoredTicks[i++];
+        }
+    }
+    restoredTicks.clear();
+}
+
 } // namespace replacement_policy
 } // namespace gem5
@@ -35,6 +35,8 @@
 #ifndef __MEM_CACHE_REPLACEMENT_POLICIES_LRU_RP_HH__
 #define __MEM_CACHE_REPLACEMENT_POLICIES_LRU_RP_HH__
 
+#include <vector>
+
 #include "mem/cache/replacement_policies/base.hh"
 
 namespace gem5
@@ -61,6 +63,27 @@ class LRU : public Base
         LRUReplData() : lastTouchTick(0) {}
     };
 
+    /**
+     * Scratch buffer the last touch timestamps of the candidates are gathered
+     * into, so that the victim can be found by a vectorized reduction.
+     */
+    mutable std::vector<Tick> candidateTicks;
+
+    /**
+     * Replacement data of the entries instantiated by instantiateEntries(),
+     * one vector per table, in instantiation order, so that it can be
+     * checkpointed. A policy may be shared by several tables, such as the
+     * per-context tables of a prefetcher. The entries are owned by their
+     * tables, which live as long as the policy.
+     */
+    std::vector<std::vector<LRUReplData *>> tables;
+
+    /**
+     * Timestamps read from a checkpoint. They are applied at startup, once
+     * the cache has reinserted its blocks, which resets their timestamps.
+     */
+    std::vector<Tick> restoredTicks;
+
   public:
     typedef LRURPParams Params;
     LRU(const Params &p);
@@ -108,6 +131,20 @@ class LRU : public Base
      * @return A shared pointer to the new replacement data.
      */
     std::shared_ptr<ReplacementData> instantiateEntry() override;
+
+    /**
+     * Instantiate the replacement data of a table in a single arena.
+     *
+     * @param num_sets Number of sets of the table.
+     * @param assoc Associativity of the table.
+     * @return Shared pointers to the replacement data of every entry.
+     */
+    std::vector<std::shared_ptr<ReplacementData>>
+    instantiateEntries(std::size_t num_sets, std::size_t assoc) override;
+
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
+    void startup() override;
 };
 
 } // namespace replacement_policy
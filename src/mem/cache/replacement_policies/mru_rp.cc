@@ -102,5 +102,11 @@ MRU::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new MRUReplData());
 }
 
+std::vector<std::shared_ptr<ReplacementData>>
+MRU::instantiateEntries(std::size_t num_sets, std::size_t assoc)
+{
+    return makeArena<MRUReplData>(num_sets * assoc);
+}
+
 } // namespace replacement_policy
 } // namespace gem5
@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/replacement_policies/opt_rp.hh"
+
+#include <cassert>
+#include <memory>
+#include <string>
+
+#include "base/logging.hh"
+#include "params/OPTRP.hh"
+#include "proto/packet.pb.h"
+#include "proto/protoio.hh"
+
+namespace gem5
+{
+
+GEM5_DEPRECATED_NAMESPACE(ReplacementPolicy, replacement_policy);
+namespace replacement_policy
+{
+
+OPT::OPT(const Params &p)
+  : Base(p), trace(p.block_size, p.lookahead), optStats(this)
+{
+    loadTrace(p.trace_file);
+}
+
+void
+OPT::loadTrace(const std::string& filename)
+{
+    ProtoInputStream trace_stream(filename);
+
+    ProtoMessage::PacketHeader header_msg;
+    panic_if(!trace_stream.read(header_msg),
+             "Failed to read packet header from %s\n", filename);
+
+    ProtoMessage::Packet pkt_msg;
+    while (trace_stream.read(pkt_msg)) {
+        fatal_if(!trace.append(pkt_msg.addr()),
+                 "%s has too many records\n", filename);
+    }
+    trace.finish();
+    warn_if(trace.size() == 0, "%s does not contain any access\n",
+            filename);
+}
+
+uint32_t
+OPT::match(const PacketPtr pkt, bool is_fill)
+{
+    const uint32_t position = trace.match(pkt->getAddr(), is_fill);
+    if (position != NoPosition) {
+        optStats.matchedAccesses++;
+    } else {
+        optStats.unmatchedAccesses++;
+    }
+    return position;
+}
+
+void
+OPT::invalidate(const std::shared_ptr<ReplacementData>& replacement_data)
+{
+    OPTReplData* data = static_cast<OPTReplData*>(replacement_data.get());
+    data->position = NoPosition;
+    data->valid = false;
+}
+
+void
+OPT::touch(const std::shared_ptr<ReplacementData>& replacement_data,
+    const PacketPtr pkt)
+{
+    OPTReplData* data = static_cast<OPTReplData*>(replacement_data.get());
+    const uint32_t position = match(pkt, false);
+    if (position != NoPosition) {
+        data->position = position;
+    }
+}
+
+void
+OPT::touch(const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+}
+
+void
+OPT::reset(const std::shared_ptr<ReplacementData>& replacement_data,
+    const PacketPtr pkt)
+{
+    OPTReplData* data = static_cast<OPTReplData*>(replacement_data.get());
+    data->position = match(pkt, true);
+    data->valid = true;
+}
+
+void
+OPT::reset(const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    OPTReplData* data = static_cast<OPTReplData*>(replacement_data.get());
+    data->position = NoPosition;
+    data->valid = true;
+}
+
+ReplaceableEntry*
+OPT::getVictim(const ReplacementCandidates& candidates) const
+{
+    // There must be at least one replacement candidate
+    assert(candidates.size() > 0);
+
+    ReplaceableEntry* victim = nullptr;
+    uint32_t victim_next_reference = 0;
+    for (const auto& candidate : candidates) {
+        OPTReplData* data = static_cast<OPTReplData*>(
+            candidate->replacementData.get());
+
+        // Invalid entries are always the best victims
+        if (!data->valid) {
+            return candidate;
+        }
+
+        // Blocks that are never referenced again are perfect victims,
+        // otherwise keep the one that is referenced the latest
+        const uint32_t next_reference =
+            trace.nextReference(data->position);
+        if (victim == nullptr || next_reference > victim_next_reference) {
+            victim = candidate;
+            victim_next_reference = next_reference;
+        }
+    }
+
+    return victim;
+}
+
+std::shared_ptr<ReplacementData>
+OPT::instantiateEntry()
+{
+    return std::shared_ptr<ReplacementData>(new OPTReplData());
+}
+
+std::vector<std::shared_ptr<ReplacementData>>
+OPT::instantiateEntries(std::size_t num_sets, std::size_t assoc)
+{
+    return makeArena<OPTReplData>(num_sets * assoc);
+}
+
+OPT::OPTStats::OPTStats(statistics::Group* parent)
+  : statistics::Group(parent),
+    ADD_STAT(matchedAccesses, statistics::units::Count::get(),
+             "Number of accesses matched to a trace record"),
+    ADD_STAT(unmatchedAccesses, statistics::units::Count::get(),
+             "Number of accesses that could not be matched to the trace")
+{
+}
+
+} // namespace replacement_policy
+} // namespace gem5
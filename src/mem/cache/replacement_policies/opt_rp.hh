@@ -0,0 +1,196 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of an optimal (Belady) replacement policy.
+ * The future of the accesses is read from a trace of the accesses to the
+ * cache recorded by a MemTraceProbe in a previous run. The victim is the
+ * candidate whose next reference is the furthest away in that trace, which
+ * makes this policy an upper bound to compare the realistic ones against.
+ */
+
+#ifndef __MEM_CACHE_REPLACEMENT_POLICIES_OPT_RP_HH__
+#define __MEM_CACHE_REPLACEMENT_POLICIES_OPT_RP_HH__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "mem/cache/replacement_policies/base.hh"
+#include "mem/cache/replacement_policies/opt_trace.hh"
+
+namespace gem5
+{
+
+struct OPTRPParams;
+
+GEM5_DEPRECATED_NAMESPACE(ReplacementPolicy, replacement_policy);
+namespace replacement_policy
+{
+
+class OPT : public Base
+{
+  protected:
+    /** Trace position used when the position of a reference is unknown. */
+    static constexpr uint32_t NoPosition = OPTTrace::NoPosition;
+
+    /** OPT-specific implementation of replacement data. */
+    struct OPTReplData : ReplacementData
+    {
+        /**
+         * Position in the trace of the last reference matched to the
+         * entry, or of a later reference to the same block once the
+         * position has been brought up to date.
+         */
+        uint32_t position;
+
+        /** Whether the entry holds a block. */
+        bool valid;
+
+        /**
+         * Default constructor. Invalidate data.
+         */
+        OPTReplData() : position(NoPosition), valid(false) {}
+    };
+
+    /** The future of the accesses, and the position of the present. */
+    OPTTrace trace;
+
+    mutable struct OPTStats : public statistics::Group
+    {
+        OPTStats(statistics::Group* parent);
+
+        /** Number of accesses matched to a trace record. */
+        statistics::Scalar matchedAccesses;
+
+        /** Number of accesses that could not be matched. */
+        statistics::Scalar unmatchedAccesses;
+    } optStats;
+
+    /**
+     * Read the trace and build the next-use index in a single streaming
+     * pass.
+     *
+     * @param filename Name of the trace file.
+     */
+    void loadTrace(const std::string& filename);
+
+    /**
+     * Match an access to a trace record, and account it.
+     *
+     * @param pkt Packet that generated the access.
+     * @param is_fill Whether the access inserts the block.
+     * @return Position of the matched record, or NoPosition.
+     */
+    uint32_t match(const PacketPtr pkt, bool is_fill);
+
+  public:
+    typedef OPTRPParams Params;
+    OPT(const Params &p);
+    ~OPT() = default;
+
+    /**
+     * Invalidate replacement data to set it as the next probable victim.
+     *
+     * @param replacement_data Replacement data to be invalidated.
+     */
+    void invalidate(const std::shared_ptr<ReplacementData>& replacement_data)
+                                                                    override;
+
+    /**
+     * Touch an entry to update its replacement data, recording the trace
+     * position of the access.
+     *
+     * @param replacement_data Replacement data to be touched.
+     * @param pkt Packet that generated this access.
+     */
+    void touch(const std::shared_ptr<ReplacementData>& replacement_data,
+        const PacketPtr pkt) override;
+
+    /**
+     * Touch an entry without a packet. The access cannot be matched to
+     * the trace, so the replacement data is not modified.
+     *
+     * @param replacement_data Replacement data to be touched.
+     */
+    void touch(const std::shared_ptr<ReplacementData>& replacement_data) const
+                                                                     override;
+
+    /**
+     * Reset replacement data. Used when an entry is inserted. Records the
+     * trace position of the access that caused the insertion.
+     *
+     * @param replacement_data Replacement data to be reset.
+     * @param pkt Packet that generated this access.
+     */
+    void reset(const std::shared_ptr<ReplacementData>& replacement_data,
+        const PacketPtr pkt) override;
+
+    /**
+     * Reset replacement data without a packet. The future of the entry is
+     * unknown, so it is considered as never referenced again.
+     *
+     * @param replacement_data Replacement data to be reset.
+     */
+    void reset(const std::shared_ptr<ReplacementData>& replacement_data) const
+                                                                     override;
+
+    /**
+     * Find the replacement victim: an invalid entry if there is one, or
+     * otherwise the entry whose next reference is the furthest away.
+     *
+     * @param candidates Replacement candidates, selected by indexing policy.
+     * @return Replacement entry to be replaced.
+     */
+    ReplaceableEntry* getVictim(const ReplacementCandidates& candidates) const
+                                                                     override;
+
+    /**
+     * Instantiate a replacement data entry.
+     *
+     * @return A shared pointer to the new replacement data.
+     */
+    std::shared_ptr<ReplacementData> instantiateEntry() override;
+
+    /**
+     * Instantiate the replacement data of a whole table in a single arena.
+     *
+     * @param num_sets Number of sets of the table.
+     * @param assoc Associativity of the table.
+     * @return Shared pointers to the replacement data of every entry.
+     */
+    std::vector<std::shared_ptr<ReplacementData>>
+    instantiateEntries(std::size_t num_sets, std::size_t assoc) override;
+};
+
+} // namespace replacement_policy
+} // namespace gem5
+
+#endif // __MEM_CACHE_REPLACEMENT_POLICIES_OPT_RP_HH__
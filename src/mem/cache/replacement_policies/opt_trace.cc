@@ -0,0 +1,125 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/replacement_policies/opt_trace.hh"
+
+#include <algorithm>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+GEM5_DEPRECATED_NAMESPACE(ReplacementPolicy, replacement_policy);
+namespace replacement_policy
+{
+
+OPTTrace::OPTTrace(unsigned blk_size, unsigned lookahead)
+  : blkMask(~Addr(blk_size - 1)), lookahead(lookahead), cursor(0)
+{
+    fatal_if(!isPowerOf2(blk_size), "The block size must be a power of 2\n");
+}
+
+bool
+OPTTrace::append(Addr addr)
+{
+    if (blockAddrs.size() == NoPosition) {
+        return false;
+    }
+
+    const uint32_t position = blockAddrs.size();
+    const Addr blk_addr = addr & blkMask;
+    blockAddrs.push_back(blk_addr);
+    nextUse.push_back(NoPosition);
+
+    auto it = lastReference.find(blk_addr);
+    if (it != lastReference.end()) {
+        nextUse[it->second] = position;
+        it->second = position;
+    } else {
+        lastReference.emplace(blk_addr, position);
+    }
+    return true;
+}
+
+void
+OPTTrace::finish()
+{
+    // Release what was only needed to build the trace
+    blockAddrs.shrink_to_fit();
+    nextUse.shrink_to_fit();
+    lastReference = {};
+    matched.assign(blockAddrs.size(), false);
+}
+
+uint32_t
+OPTTrace::match(Addr addr, bool is_fill)
+{
+    const Addr blk_addr = addr & blkMask;
+    const uint32_t num_records = blockAddrs.size();
+
+    // A fill may refer to a miss that was already skipped by later hits
+    if (is_fill) {
+        const uint32_t begin = cursor > lookahead ? cursor - lookahead : 0;
+        for (uint32_t i = cursor; i > begin; i--) {
+            if (blockAddrs[i - 1] == blk_addr && !matched[i - 1]) {
+                matched[i - 1] = true;
+                return i - 1;
+            }
+        }
+    }
+
+    const uint32_t end = std::min<uint64_t>(num_records,
+        uint64_t(cursor) + lookahead);
+    for (uint32_t i = cursor; i < end; i++) {
+        if (blockAddrs[i] == blk_addr && !matched[i]) {
+            matched[i] = true;
+            cursor = i + 1;
+            return i;
+        }
+    }
+
+    return NoPosition;
+}
+
+uint32_t
+OPTTrace::nextReference(uint32_t position) const
+{
+    // The matched reference itself has already happened
+    if (position != NoPosition) {
+        position = nextUse[position];
+    }
+    while (position != NoPosition && position < cursor) {
+        position = nextUse[position];
+    }
+    return position;
+}
+
+} // namespace replacement_policy
+} // namespace gem5
@@ -0,0 +1,143 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Future of the accesses to a cache, as used by the optimal replacement
+ * policy: the block addresses of a recorded trace of the accesses, indexed
+ * by the position of the next reference to each block, and the matching of
+ * the accesses of the current run to the records of the trace.
+ */
+
+#ifndef __MEM_CACHE_REPLACEMENT_POLICIES_OPT_TRACE_HH__
+#define __MEM_CACHE_REPLACEMENT_POLICIES_OPT_TRACE_HH__
+
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "base/compiler.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+GEM5_DEPRECATED_NAMESPACE(ReplacementPolicy, replacement_policy);
+namespace replacement_policy
+{
+
+class OPTTrace
+{
+  public:
+    /** Trace position used when the position of a reference is unknown. */
+    static constexpr uint32_t NoPosition =
+        std::numeric_limits<uint32_t>::max();
+
+    /**
+     * @param blk_size Size of the blocks the addresses are aligned to;
+     *        must be a power of 2.
+     * @param lookahead Number of records searched to match an access.
+     */
+    OPTTrace(unsigned blk_size, unsigned lookahead);
+
+    /** Number of records of the trace. */
+    uint32_t size() const { return blockAddrs.size(); }
+
+    /**
+     * Append a record to the trace, and link the previous reference to
+     * the same block to it.
+     *
+     * @param addr Address of the access.
+     * @return False if the trace cannot hold any more records.
+     */
+    bool append(Addr addr);
+
+    /**
+     * Finish building the trace. It must be called once every record has
+     * been appended, and before any access is matched.
+     */
+    void finish();
+
+    /**
+     * Match an access to a trace record that has not been matched yet.
+     * Hits are matched to the first record of the block after the cursor,
+     * and move the cursor past it. Fills happen after the miss that caused
+     * them, and possibly after later hits have moved the cursor past the
+     * miss record, so they are first matched backwards.
+     *
+     * @param addr Address of the access.
+     * @param is_fill Whether the access inserts the block.
+     * @return Position of the matched record, or NoPosition.
+     */
+    uint32_t match(Addr addr, bool is_fill);
+
+    /**
+     * Get the position of the next reference to a block that has not
+     * happened yet, by following the next-use index from the position of
+     * its last known reference.
+     *
+     * @param position Position of a reference to the block.
+     * @return Position of its next reference, or NoPosition.
+     */
+    uint32_t nextReference(uint32_t position) const;
+
+  private:
+    /** Mask that aligns an address to its block. */
+    const Addr blkMask;
+
+    /** Number of trace records searched to match an access. */
+    const unsigned lookahead;
+
+    /** Block-aligned address of every record of the trace. */
+    std::vector<Addr> blockAddrs;
+
+    /**
+     * Next-use index: position of the next record referencing the same
+     * block as each record, or NoPosition if the block is never referenced
+     * again.
+     */
+    std::vector<uint32_t> nextUse;
+
+    /** Whether each record has already been matched to an access. */
+    std::vector<bool> matched;
+
+    /**
+     * Position of the last reference to every block appended so far. It is
+     * only needed while the trace is built.
+     */
+    std::unordered_map<Addr, uint32_t> lastReference;
+
+    /** Position of the first trace record that has not been matched. */
+    uint32_t cursor;
+};
+
+} // namespace replacement_policy
+} // namespace gem5
+
+#endif // __MEM_CACHE_REPLACEMENT_POLICIES_OPT_TRACE_HH__
@@ -0,0 +1,154 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "base/types.hh"
+#include "mem/cache/replacement_policies/opt_trace.hh"
+
+using namespace gem5;
+using replacement_policy::OPTTrace;
+
+namespace
+{
+
+const Addr blockA = 0x1000;
+const Addr blockB = 0x2000;
+const Addr blockC = 0x3000;
+const Addr blockD = 0x4000;
+const Addr blockE = 0x5000;
+
+/**
+ * Build the trace A B A C B D A E, with 64-byte blocks. Some records are
+ * not aligned to their block.
+ */
+void
+buildTrace(OPTTrace &trace)
+{
+    const Addr addrs[] = {blockA, blockB + 0x10, blockA + 0x3f, blockC,
+                          blockB, blockD, blockA, blockE};
+    for (const Addr addr : addrs) {
+        ASSERT_TRUE(trace.append(addr));
+    }
+    trace.finish();
+    ASSERT_EQ(trace.size(), 8);
+}
+
+} // anonymous namespace
+
+/** The next-use index links the references to the same block. */
+TEST(OPTTraceTest, NextUse)
+{
+    OPTTrace trace(64, 1024);
+    buildTrace(trace);
+
+    ASSERT_EQ(trace.nextReference(0), 2);
+    ASSERT_EQ(trace.nextReference(2), 6);
+    ASSERT_EQ(trace.nextReference(1), 4);
+
+    // Blocks that are never referenced again
+    ASSERT_EQ(trace.nextReference(3), OPTTrace::NoPosition);
+    ASSERT_EQ(trace.nextReference(5), OPTTrace::NoPosition);
+    ASSERT_EQ(trace.nextReference(6), OPTTrace::NoPosition);
+    ASSERT_EQ(trace.nextReference(7), OPTTrace::NoPosition);
+    ASSERT_EQ(trace.nextReference(OPTTrace::NoPosition),
+              OPTTrace::NoPosition);
+}
+
+/** Hits are matched in order, and move the cursor past their record. */
+TEST(OPTTraceTest, Hits)
+{
+    OPTTrace trace(64, 1024);
+    buildTrace(trace);
+
+    ASSERT_EQ(trace.match(blockA + 8, false), 0);
+    ASSERT_EQ(trace.match(blockA, false), 2);
+
+    // The reference to B at position 1 is behind the cursor, so its next
+    // reference is the one at position 4
+    ASSERT_EQ(trace.nextReference(0), 6);
+    ASSERT_EQ(trace.match(blockB, false), 4);
+
+    // The reference at 4 has been skipped over too
+    ASSERT_EQ(trace.nextReference(1), OPTTrace::NoPosition);
+}
+
+/**
+ * Fills are matched to the miss that caused them, even when later hits
+ * have already moved the cursor past it.
+ */
+TEST(OPTTraceTest, FillsBehindCursor)
+{
+    OPTTrace trace(64, 1024);
+    buildTrace(trace);
+
+    // The miss to B at position 1 is only filled after the hit to A at 2
+    ASSERT_EQ(trace.match(blockA, true), 0);
+    ASSERT_EQ(trace.match(blockA, false), 2);
+    ASSERT_EQ(trace.match(blockB, true), 1);
+
+    // A record is only matched once: the next fill of A is the one at 6
+    ASSERT_EQ(trace.match(blockA, true), 6);
+    ASSERT_EQ(trace.nextReference(6), OPTTrace::NoPosition);
+
+    // Fills that are not behind the cursor are matched forwards
+    OPTTrace forward(64, 1024);
+    buildTrace(forward);
+    ASSERT_EQ(forward.match(blockC, true), 3);
+
+    // That skipped over the reference to A at position 2
+    ASSERT_EQ(forward.nextReference(0), 6);
+}
+
+/**
+ * Accesses that are not in the trace, or beyond the lookahead, are not
+ * matched, and leave the cursor where it is.
+ */
+TEST(OPTTraceTest, UnmatchedAccesses)
+{
+    OPTTrace trace(64, 4);
+    buildTrace(trace);
+
+    ASSERT_EQ(trace.match(0x9000, false), OPTTrace::NoPosition);
+    ASSERT_EQ(trace.match(0x9000, true), OPTTrace::NoPosition);
+
+    // E is at position 7, outside of the window [0, 4)
+    ASSERT_EQ(trace.match(blockE, false), OPTTrace::NoPosition);
+    ASSERT_EQ(trace.match(blockA, false), 0);
+
+    // Once the cursor has moved, E is within the window [3, 7) ...
+    ASSERT_EQ(trace.match(blockC, false), 3);
+    ASSERT_EQ(trace.match(blockD, false), 5);
+    ASSERT_EQ(trace.match(blockE, false), 7);
+
+    // ...and the trace is exhausted
+    ASSERT_EQ(trace.match(blockA, false), OPTTrace::NoPosition);
+    ASSERT_EQ(trace.match(blockB, true), 4);
+}
@@ -96,5 +96,11 @@ Random::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new RandomReplData());
 }
 
+std::vector<std::shared_ptr<ReplacementData>>
+Random::instantiateEntries(std::size_t num_sets, std::size_t assoc)
+{
+    return makeArena<RandomReplData>(num_sets * assoc);
+}
+
 } // namespace replacement_policy
 } // namespace gem5
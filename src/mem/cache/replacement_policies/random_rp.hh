@@ -35,6 +35,8 @@
 #ifndef __MEM_CACHE_REPLACEMENT_POLICIES_RANDOM_RP_HH__
 #define __MEM_CACHE_REPLACEMENT_POLICIES_RANDOM_RP_HH__
 
+#include <vector>
+
 #include "mem/cache/replacement_policies/base.hh"
 
 namespace gem5
@@ -111,6 +113,16 @@ class Random : public Base
      * @return A shared pointer to the new replacement data.
      */
     std::shared_ptr<ReplacementData> instantiateEntry() override;
+
+    /**
+     * Instantiate the replacement data of a table in a single arena.
+     *
+     * @param num_sets Number of sets of the table.
+     * @param assoc Associativity of the table.
+     * @return Shared pointers to the replacement data of every entry.
+     */
+    std::vector<std::shared_ptr<ReplacementData>>
+    instantiateEntries(std::size_t num_sets, std::size_t assoc) override;
 };
 
 } // namespace replacement_policy
@@ -28,54 +28,30 @@
 
 #include "mem/cache/replacement_policies/sc_rp.hh"
 
-#include <cassert>
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <string>
 
-#include "params/SCRP.hh" // Change to SCRP.hh later
+#include "base/cprintf.hh"
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/ReplacementSC.hh"
+#include "params/SCRP.hh"
 #include "sim/cur_tick.hh"
+#include "sim/serialize.hh"
 
-#define DBPRINTSCDATA(my_set)                                                                     \
-    do                                                                                            \
-    {                                                                                             \
-        for (int i = 0; i < num_assoc; i++)                                                       \
-        {                                                                                         \
-            printf("SC_Set_Data for cache way%2d, ", i);                                          \
-            for (int j = 0; j < num_sc_ways; j++)                                                 \
-            {                                                                                     \
-                if ((set_data[my_set].sc_data[i][j] & 0x80) == 0x00)                              \
-                {                                                                                 \
-                    printf("SC-way%d:  e ", j);                                                    \
-                }                                                                                 \
-                else                                                                              \
-                {                                                                                 \
-                    printf("SC-way%d: %2d ", j, set_data[my_set].sc_data[i][j] & (num_assoc - 1)); \
-                }                                                                                 \
-            }                                                                                     \
-            printf("\n");                                                                         \
-        }                                                                                         \
-    } while (0);
-
-#define DBPRINTSCPTRS(my_set)                                   \
-    do                                                          \
-    {                                                           \
-        printf("SC Pointers: ");                                \
-        for (int i = 0; i < num_sc_ways; i++)                   \
-        {                                                       \
-            printf("%d, ", set_data[my_set].sc_way_ptr_map[i]); \
-        }                                                       \
-        printf("\n");                                           \
-    } while (0);
-
-#define DBPRINTSCNVCS(my_set)                                \
-    do                                                       \
-    {                                                        \
-        printf("SC NVC for Set %d: ", my_set);               \
-        for (int i = 0; i < num_sc_ways; i++)                \
-        {                                                    \
-            printf("%d, ", set_data[my_set].sc_set_nvcs[i]); \
-        }                                                    \
-        printf("\n");                                        \
-    } while (0);
+/**
+ * Trace a Shepherd Cache event of a set. Like DPRINTF, this compiles away
+ * when tracing is disabled; when it is enabled, only the sets within the
+ * traced range are printed.
+ */
+#define SC_DPRINTF(set, ...) do {                                        \
+    if (GEM5_UNLIKELY(TRACING_ON && ::gem5::debug::ReplacementSC) &&     \
+        isTraced(set)) {                                                 \
+        DPRINTF(ReplacementSC, __VA_ARGS__);                             \
+    }                                                                    \
+} while (0)
 
 namespace gem5
 {
@@ -84,243 +60,301 @@ GEM5_DEPRECATED_NAMESPACE(ReplacementPolicy, replacement_policy);
 namespace replacement_policy
 {
 
-static uint32_t count_LRU = 0;
-static uint32_t count_SC = 0;
-static uint32_t debug_flag = 0;
-static int debug_set = -1;
-static int debug_way = -1;
-
 SC::SC(const Params &p)
-  : Base(p), num_sc_ways(p.num_sc_ways)
+  : Base(p),
+    traceFirstSet(p.trace_first_set), traceLastSet(p.trace_last_set),
+    prefetchPriorityThreshold(p.prefetch_priority_threshold),
+    state(p.num_sc_ways, p.counter_bits),
+    scStats(this, p.num_sc_ways)
 {
-    fatal_if(!!(num_sc_ways & (num_sc_ways - 1)) || num_sc_ways < 0 || num_sc_ways > 8, 
-        "Number of Shepherd Cache ways has to be a power of 2 and between [0, 8]\n");
 }
 
-void // NOTE: NOT DONE YET!!! Placeholder for now
+void
 SC::invalidate(const std::shared_ptr<ReplacementData>& replacement_data)
 {
-    std::shared_ptr<SCReplData> casted_replacement_data =
-        std::static_pointer_cast<SCReplData>(replacement_data);
-    // Reset insertion tick
-    casted_replacement_data->tickInserted = Tick(0);
-    // Reset LRU touch tick
-    casted_replacement_data->tickAccessed = Tick(0);
-
-    // Clear Shepherd Cache Counter and set it to empty for that set
-    // Need to think through what else to write for this
-    // casted_replacement_data->valid = false;
-    if (debug_flag && debug_set == casted_replacement_data->my_set && debug_way == casted_replacement_data->my_way) {
-        printf("Called Invalidate function with set: %d, way: %d\n", casted_replacement_data->my_set, casted_replacement_data->my_way);
-    }
+    const SCReplData* casted_replacement_data =
+        static_cast<const SCReplData*>(replacement_data.get());
+    int my_set_idx = casted_replacement_data->my_set;
+    int my_way_idx = casted_replacement_data->my_way;
+
+    state.invalidate(my_set_idx, my_way_idx);
+    SC_DPRINTF(my_set_idx, "invalidate set=%d way=%d\n", my_set_idx,
+               my_way_idx);
+    traceSetState(my_set_idx);
 }
 
 void
 SC::touch(const std::shared_ptr<ReplacementData>& replacement_data) const
 {
-    // At touch (cache hit), the count list of a certain sc-entry will be updated
-    // if that sc-entry is valid and empty
-    std::shared_ptr<SCReplData> casted_replacement_data =
-        std::static_pointer_cast<SCReplData>(replacement_data);
-    // Touched the entry, LRU tick needs update
-    casted_replacement_data->tickAccessed = curTick();
-    
-    // Every time a touch happens, the counter and NVC need to be updated accordingly
+    // At touch (cache hit), the count list of a certain sc-entry will be
+    // updated if that sc-entry is valid and empty
+    const SCReplData* casted_replacement_data =
+        static_cast<const SCReplData*>(replacement_data.get());
     int my_set_idx = casted_replacement_data->my_set;
     int my_way_idx = casted_replacement_data->my_way;
 
-    if (debug_flag && debug_set == my_set_idx && debug_way == my_way_idx) {
-        printf("Before calling touch\n");
-        DBPRINTSCDATA(my_set_idx);
-        DBPRINTSCPTRS(my_set_idx);
-        DBPRINTSCNVCS(my_set_idx);
-    }
+    state.touch(my_set_idx, my_way_idx, curTick());
+    SC_DPRINTF(my_set_idx, "touch set=%d way=%d\n", my_set_idx, my_way_idx);
+    traceSetState(my_set_idx);
+}
 
-    /**
-     * Search through all the SC entries and find which SC-way's counter and NVC
-     * needs to be updated. If the entry is empty then copy previous NVC value to
-     * the counter and increment NVC by 1, otherwise preserve the value and don't
-     * increment NVC
-     */
-    for (int i = 0; i < num_sc_ways; i++) {
-        if (!!(set_data[my_set_idx].sc_data[my_way_idx][i] & 0x80) == 0) {
-            set_data[my_set_idx].sc_data[my_way_idx][i] = 0x80 | (set_data[my_set_idx].sc_set_nvcs[i] & (num_assoc - 1));
-            set_data[my_set_idx].sc_set_nvcs[i] += 1;
-        }
-    }
+void
+SC::reset(const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    const SCReplData* casted_replacement_data =
+        static_cast<const SCReplData*>(replacement_data.get());
+    int my_set_idx = casted_replacement_data->my_set;
+    int my_way_idx = casted_replacement_data->my_way;
+
+    recordFill(my_set_idx, my_way_idx,
+               state.reset(my_set_idx, my_way_idx, curTick()));
+}
 
-    if (debug_flag && debug_set == my_set_idx && debug_way == my_way_idx) {
-        printf("Called touch function with set: %d, way: %d\n", casted_replacement_data->my_set, casted_replacement_data->my_way);
-        DBPRINTSCDATA(my_set_idx);
-        DBPRINTSCPTRS(my_set_idx);
-        DBPRINTSCNVCS(my_set_idx);
-        debug_flag = 0;
+void
+SC::recordFill(int set, int way, const SCState::Fill &fill) const
+{
+    if (fill.repointed) {
+        scStats.promotions[fill.scWay]++;
+        SC_DPRINTF(set, "reset set=%d way=%d sc_way=%d old_ptr=%d\n", set,
+                   way, fill.scWay, fill.oldPtr);
+    } else {
+        SC_DPRINTF(set, "reset set=%d way=%d sc_way=%d\n", set, way,
+                   fill.scWay);
     }
+    traceSetState(set);
 }
 
 void
-SC::reset(const std::shared_ptr<ReplacementData>& replacement_data) const
+SC::reset(const std::shared_ptr<ReplacementData>& replacement_data,
+          const PacketPtr pkt)
 {
-    // Set insertion tick
-    std::shared_ptr<SCReplData> casted_replacement_data =
-        std::static_pointer_cast<SCReplData>(replacement_data);
-    casted_replacement_data->tickInserted = curTick();
-    // LRU Tick also needs update
-    casted_replacement_data->tickAccessed = curTick();
-    casted_replacement_data->valid = true;
+    reset(replacement_data);
+    if (!isUnconfidentPrefetch(pkt, prefetchPriorityThreshold)) {
+        return;
+    }
 
+    const SCReplData* casted_replacement_data =
+        static_cast<const SCReplData*>(replacement_data.get());
     int my_set_idx = casted_replacement_data->my_set;
     int my_way_idx = casted_replacement_data->my_way;
-    /**
-     * When reset is called, this means that we are inserting a new entry
-     * into the cache, whether if it's through replacement or just populating
-     * the cache initially. We clear whichever SC-way's sc_data to all empty 
-     * and set all the counters along the way to 0
-     */
-    // First find the SC entry 
-    int sc_way_idx = 0;
-    int found_sc_way = 0;
-    for (int i = 0; i < num_sc_ways; i++) {
-        if (my_way_idx == set_data[my_set_idx].sc_way_ptr_map[i]) {
-            // Found the SC entry, set all counter along that way to 0
-            sc_way_idx = i;
-            found_sc_way = 1;
-            break;
-        }
-    }
 
-    if (found_sc_way) { // Only do it if it found an SC way, otherwise do nothing
-        std::fill(set_data[my_set_idx].sc_data[my_way_idx].begin(), set_data[my_set_idx].sc_data[my_way_idx].end(), 0x80); 
-        for (int i = 0; i < num_assoc; i++) {
-            set_data[my_set_idx].sc_data[i][sc_way_idx] &= 0x00;
-        }
-        set_data[my_set_idx].sc_set_nvcs[sc_way_idx] = 0;
-    }
-    if (debug_flag && debug_set == my_set_idx && debug_way == my_way_idx) {
-        printf("Called reset function with set: %d, way: %d\n", casted_replacement_data->my_set, casted_replacement_data->my_way);
-        printf("After Reset Clears SC Data\n");
-        DBPRINTSCDATA(my_set_idx);
-        DBPRINTSCPTRS(my_set_idx);
-        DBPRINTSCNVCS(my_set_idx);
-    }
+    scStats.unconfidentPrefetches++;
+    state.demote(my_set_idx, my_way_idx);
+    SC_DPRINTF(my_set_idx, "demote set=%d way=%d\n", my_set_idx,
+               my_way_idx);
+    traceSetState(my_set_idx);
 }
 
 ReplaceableEntry*
 SC::getVictim(const ReplacementCandidates& candidates) const
 {
-    // There must be at least one replacement candidate
-    assert(candidates.size() > 0);
-
-    int set_num = candidates[0]->getSet();
-
-    /** 
-     * Handle compulsory misses by finding the first invalid block 
-     */
-    for (const auto& candidate : candidates) {  
-        if (std::static_pointer_cast<SCReplData>(candidate->replacementData)->valid == false) {
-            // printf("Compulsory Miss, candidate set: %d, way: %d\n", candidate->getSet(), candidate->getWay());
-            return candidate;
-        }
-    }
-        
-    /** 
-     * There are no empty blocks remaining, check within shepherd cache
-     * to find the right victim to replace, use FIFO to determine which
-     * shepherd cache entry will be used to replace things 
-     */
-    int sc_way_num = 0;
-    ReplaceableEntry* sc_candidate = candidates[set_data[set_num].sc_way_ptr_map[0]];
-    ReplaceableEntry* sc_victim = sc_candidate;
-    auto sc_candidate_rep_ptr = std::static_pointer_cast<SCReplData>(sc_candidate->replacementData);
-    auto sc_victim_rep_ptr = std::static_pointer_cast<SCReplData>(sc_victim->replacementData);
-    for (int i = 1; i < num_sc_ways; i++) {
-        sc_candidate = candidates[set_data[set_num].sc_way_ptr_map[i]];
-        sc_candidate_rep_ptr = std::static_pointer_cast<SCReplData>(sc_candidate->replacementData);
-        if (sc_candidate_rep_ptr->tickInserted < sc_victim_rep_ptr->tickInserted) {
-            sc_victim = sc_candidate;
-            sc_victim_rep_ptr = std::static_pointer_cast<SCReplData>(sc_victim->replacementData);
-            sc_way_num = i;
-        }
+    const SCState::Victim victim = state.getVictim(candidates);
+    const int set_num = candidates[0]->getSet();
+
+    switch (victim.source) {
+      case SCState::VictimSource::Invalid:
+        scStats.invalidVictims++;
+        return candidates[victim.index];
+      case SCState::VictimSource::LRU:
+        scStats.lruVictims++;
+        break;
+      case SCState::VictimSource::SC:
+        scStats.scVictims++;
+        scStats.victimCounts.sample(victim.count);
+        break;
     }
-    
-    /** 
-     * Use the found Shepherd Cache entry to perform replacement on the rest
-     * of the cache block, using LRU within the empty items if all counters 
-     * aren't full and otherwise find the largest count and return that as 
-     * the candidate of replacement 
-     */
-    int use_LRU = 0;
-    int max_ct = -1;
-    int max_way = 0;
-    uint8_t sc_val = 0;
-    ReplaceableEntry* victim = NULL;
-    std::shared_ptr<SCReplData> candidate_rep_ptr = NULL;
-    std::shared_ptr<SCReplData> victim_rep_ptr = NULL;
-    for (int j = 0; j < num_assoc; j++) {
-        sc_val = set_data[set_num].sc_data[j][sc_way_num];
-        if (!!(sc_val & 0x80) == 0) {
-            // Detected an empty flag, use LRU replacement and
-            // return the right candidate
-            use_LRU = 1;
-            // Perform LRU also
-            candidate_rep_ptr = std::static_pointer_cast<SCReplData>(candidates[j]->replacementData);
-            if (victim == NULL) {
-                victim = candidates[j];
-                victim_rep_ptr = std::static_pointer_cast<SCReplData>(candidates[j]->replacementData);
-            } else if (victim_rep_ptr != NULL && candidate_rep_ptr->tickAccessed < victim_rep_ptr->tickAccessed) {
-                victim = candidates[j];
-                victim_rep_ptr = std::static_pointer_cast<SCReplData>(candidates[j]->replacementData);
-            }
+
+    if (victim.scWay >= 0) {
+        scStats.promotions[victim.scWay]++;
+        if (victim.source == SCState::VictimSource::LRU) {
+            SC_DPRINTF(set_num, "victim set=%d way=%d sc_way=%d "
+                       "old_ptr=%d policy=lru\n", set_num, victim.index,
+                       victim.scWay, victim.oldPtr);
         } else {
-            // Find the way with the maximum count and save its index
-            if ((sc_val & (num_assoc - 1)) > max_ct) {
-                max_ct = sc_val & (num_assoc - 1);
-                max_way = j;
-            }
+            SC_DPRINTF(set_num, "victim set=%d way=%d sc_way=%d "
+                       "old_ptr=%d policy=sc count=%d\n", set_num,
+                       victim.index, victim.scWay, victim.oldPtr,
+                       victim.count);
         }
     }
-    
-    /**
-     * If we use LRU to replace, we look through every entry that's not a
-     * shephered cache entry and find the least recently used item to kick out
-     * Upon replacement, we also swap the pointer of the SC-candidate and MC-
-     * candidate, demoting the SC-candidate to MC and setting newest item to
-     * replace the old one as SC-candidate's SC entry, swap sc_data entries also
-     */
-    if (count_LRU % 50000 == 0) {
-        printf("LRU Count: %d, SC Count: %d\n", count_LRU, count_SC);
+
+    if (!victim.reused) {
+        scStats.deadVictims++;
     }
-    int old_sc_way_idx = set_data[set_num].sc_way_ptr_map[sc_way_num];
-    if (use_LRU) {
-        count_LRU++;
-        // DBPRINTSCDATA()
-        set_data[set_num].sc_way_ptr_map[sc_way_num] = victim->getWay(); 
-        return victim;
-    } else {
-        // debug_flag = 1;
-        count_SC++;
-        debug_way = candidates[max_way]->getWay();
-        debug_set = candidates[max_way]->getSet();
-        if (debug_flag) {
-            printf("Found Shepherd Cache Way: %1d, it's way in the set is: %2d\n", sc_way_num, set_data[set_num].sc_way_ptr_map[sc_way_num]);
-            printf("Shepherd Cache Generated Victim, candidate set: %d, way: %d\n", candidates[max_way]->getSet(), candidates[max_way]->getWay());
-            printf("Before Shepherd Cache swaps the pointer\n");
-            DBPRINTSCDATA(set_num);
-            DBPRINTSCPTRS(set_num);
-        }
-        set_data[set_num].sc_way_ptr_map[sc_way_num] = candidates[max_way]->getWay();
-        if (debug_flag) {
-            printf("After Shepherd Cache swaps the pointer\n");
-            DBPRINTSCPTRS(set_num);
+    return candidates[victim.index];
+}
+
+void
+SC::traceSetState(int set) const
+{
+    if (!GEM5_UNLIKELY(TRACING_ON && debug::ReplacementSC) ||
+        !isTraced(set)) {
+        return;
+    }
+
+    for (int i = 0; i < state.num_sc_ways; i++) {
+        std::string counters;
+        for (int way = 0; way < state.num_assoc; way++) {
+            counters += state.isFull(set, i, way) ?
+                csprintf(" %d", state.count(set, i, way)) : " e";
         }
-        return candidates[max_way];
+        DPRINTF(ReplacementSC, "state set=%d sc_way=%d ptr=%d nvc=%d "
+                "counters=%s\n", set, i, state.pointer(set, i),
+                state.nvc(set, i), counters);
     }
 }
 
 std::shared_ptr<ReplacementData>
 SC::instantiateEntry()
 {
-    return std::shared_ptr<ReplacementData>(new SCReplData());
+    panic("The Shepherd Cache replacement data must be instantiated "
+          "through instantiateEntries()\n");
+}
+
+std::vector<std::shared_ptr<ReplacementData>>
+SC::instantiateEntries(std::size_t sets, std::size_t assoc)
+{
+    // The state is laid out for a single table
+    fatal_if(state.num_sets != 0, "%s cannot be shared by several tables\n",
+             name());
+
+    // Initialize the cache information and all the per-set information
+    state.init(sets, assoc);
+
+    auto entries = makeArena<SCReplData>(sets * assoc);
+    for (std::size_t i = 0; i < entries.size(); i++) {
+        auto casted_replacement_data =
+            static_cast<SCReplData*>(entries[i].get());
+        casted_replacement_data->my_set = i / assoc;
+        casted_replacement_data->my_way = i % assoc;
+    }
+    return entries;
+}
+
+void
+SC::serialize(CheckpointOut &cp) const
+{
+    const int num_sets = state.num_sets;
+    const int num_assoc = state.num_assoc;
+    const unsigned counterBits = state.counterBits;
+    SERIALIZE_SCALAR(num_sets);
+    SERIALIZE_SCALAR(num_assoc);
+    SERIALIZE_SCALAR(counterBits);
+
+    std::vector<Tick> tick_inserted(state.tickInserted);
+    std::vector<Tick> tick_accessed(state.tickAccessed);
+    std::vector<uint8_t> entry_valid(state.entryValid);
+    std::vector<uint8_t> entry_reused(state.entryReused);
+    SERIALIZE_CONTAINER(tick_inserted);
+    SERIALIZE_CONTAINER(tick_accessed);
+    SERIALIZE_CONTAINER(entry_valid);
+    SERIALIZE_CONTAINER(entry_reused);
+
+    // The counters, NVCs and SC-way pointers are saved as raw bytes, as
+    // their layout only depends on the geometry and counter width
+    std::vector<uint8_t> set_bytes(
+        state.set_data.size() * SCState::SetLineSize);
+    if (!set_bytes.empty()) {
+        std::memcpy(set_bytes.data(), state.set_data.data(),
+                    set_bytes.size());
+    }
+    SERIALIZE_CONTAINER(set_bytes);
+}
+
+void
+SC::unserialize(CheckpointIn &cp)
+{
+    // Checkpoints that predate the Shepherd Cache state do not have it
+    if (!cp.entryExists(Serializable::currentSection(), "set_bytes")) {
+        return;
+    }
+
+    int num_sets;
+    int num_assoc;
+    unsigned counterBits;
+    UNSERIALIZE_SCALAR(num_sets);
+    UNSERIALIZE_SCALAR(num_assoc);
+    UNSERIALIZE_SCALAR(counterBits);
+    if (num_sets != state.num_sets || num_assoc != state.num_assoc ||
+        counterBits != state.counterBits) {
+        warn("%s: The checkpointed Shepherd Cache state does not match "
+             "the geometry of the cache; ignoring it.\n", name());
+        return;
+    }
+
+    std::vector<Tick> tick_inserted;
+    std::vector<Tick> tick_accessed;
+    std::vector<uint8_t> entry_valid;
+    std::vector<uint8_t> entry_reused;
+    std::vector<uint8_t> set_bytes;
+    UNSERIALIZE_CONTAINER(tick_inserted);
+    UNSERIALIZE_CONTAINER(tick_accessed);
+    UNSERIALIZE_CONTAINER(entry_valid);
+    UNSERIALIZE_CONTAINER(entry_reused);
+    UNSERIALIZE_CONTAINER(set_bytes);
+    fatal_if(tick_inserted.size() != state.tickInserted.size() ||
+             tick_accessed.size() != state.tickAccessed.size() ||
+             entry_valid.size() != state.entryValid.size() ||
+             entry_reused.size() != state.entryReused.size() ||
+             set_bytes.size() !=
+                 state.set_data.size() * SCState::SetLineSize,
+             "%s: Malformed Shepherd Cache checkpoint.\n", name());
+
+    restored.valid = true;
+    restored.tickInserted = std::move(tick_inserted);
+    restored.tickAccessed = std::move(tick_accessed);
+    restored.entryValid = std::move(entry_valid);
+    restored.entryReused = std::move(entry_reused);
+    restored.setData = std::move(set_bytes);
+}
+
+void
+SC::startup()
+{
+    if (!restored.valid) {
+        return;
+    }
+    state.tickInserted = std::move(restored.tickInserted);
+    state.tickAccessed = std::move(restored.tickAccessed);
+    state.entryValid = std::move(restored.entryValid);
+    state.entryReused = std::move(restored.entryReused);
+    if (!restored.setData.empty()) {
+        std::memcpy(state.set_data.data(), restored.setData.data(),
+                    restored.setData.size());
+    }
+    restored = {};
+}
+
+SC::SCStats::SCStats(statistics::Group* parent, int num_sc_ways)
+  : statistics::Group(parent),
+    ADD_STAT(invalidVictims, statistics::units::Count::get(),
+             "Number of victims that were invalid entries"),
+    ADD_STAT(lruVictims, statistics::units::Count::get(),
+             "Number of victims selected by LRU among the empty counters"),
+    ADD_STAT(scVictims, statistics::units::Count::get(),
+             "Number of victims selected by the largest Shepherd Cache "
+             "count"),
+    ADD_STAT(promotions, statistics::units::Count::get(),
+             "Number of times each Shepherd Cache way was pointed to a new "
+             "entry"),
+    ADD_STAT(victimCounts, statistics::units::Count::get(),
+             "Count of the victims selected by the largest Shepherd Cache "
+             "count"),
+    ADD_STAT(deadVictims, statistics::units::Count::get(),
+             "Number of valid victims that were never reused"),
+    ADD_STAT(deadVictimRatio, statistics::units::Ratio::get(),
+             "Ratio of valid victims that were never reused",
+             deadVictims / (lruVictims + scVictims)),
+    ADD_STAT(unconfidentPrefetches, statistics::units::Count::get(),
+             "Number of prefetches inserted as the next victim of their set")
+{
+    promotions
+        .init(std::max(num_sc_ways, 1))
+        .flags(statistics::total | statistics::nozero);
+    victimCounts
+        .init(16)
+        .flags(statistics::pdf | statistics::nozero);
+    deadVictimRatio.flags(statistics::nozero);
 }
 
 } // namespace replacement_policy
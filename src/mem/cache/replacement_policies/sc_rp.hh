@@ -28,16 +28,25 @@
 
 /**
  * @file
- * Declaration of a First In First Out replacement policy.
- * The victim is chosen using the timestamp. The oldest entry is always chosen
- * to be evicted, regardless of the amount of times it has been touched.
+ * Declaration of a Shepherd Cache replacement policy.
+ * A few ways of each set act as Shepherd Cache (SC) ways, which track the
+ * order in which the other entries of the set are reused to emulate an
+ * optimal replacement decision; LRU is used when that order is unknown.
+ * The per-set state, kept in an SCState, is sized from the table geometry
+ * handed to instantiateEntries(), so the policy works with any tag store.
  */
 
 #ifndef __MEM_CACHE_REPLACEMENT_POLICIES_SC_RP_HH__
 #define __MEM_CACHE_REPLACEMENT_POLICIES_SC_RP_HH__
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "base/statistics.hh"
 #include "base/types.hh"
 #include "mem/cache/replacement_policies/base.hh"
+#include "mem/cache/replacement_policies/sc_state.hh"
 
 namespace gem5
 {
@@ -51,71 +60,107 @@ namespace replacement_policy
 class SC : public Base
 {
   public:
-    /** Number of SC Ways passed in as parameter */
-    int num_sc_ways;
+    /**
+     * Range of sets, inclusive, whose events are traced when the
+     * ReplacementSC debug flag is enabled. A negative last set extends the
+     * range up to the last set.
+     */
+    const int traceFirstSet;
+    const int traceLastSet;
+
+    /**
+     * Prefetches whose priority is lower than this are inserted as the
+     * next victim of their set.
+     */
+    const int32_t prefetchPriorityThreshold;
 
-    /** Cache structure info */
-    int num_assoc;
-    int num_sets;
+    /** Whether the events of a set are traced. */
+    bool
+    isTraced(int set) const
+    {
+        return set >= traceFirstSet &&
+            (traceLastSet < 0 || set <= traceLastSet);
+    }
 
-    /** Shepherd-Cache specific implementation of replacement data. */
+    /**
+     * Shepherd-Cache specific implementation of replacement data. The
+     * timestamps and valid flag of the entry are kept in the packed per-set
+     * arrays of the policy, so the entry only records where it lives.
+     */
     struct SCReplData : ReplacementData
     {
-        /** Tick on which the entry was inserted. */
-        Tick tickInserted;
-        Tick tickAccessed;
-        bool valid;
         int my_set;
         int my_way;
 
         /**
          * Default constructor
          */
-        SCReplData() : tickInserted(0), tickAccessed(0), valid(false), my_set(0), my_way(0) {}
+        SCReplData() : my_set(0), my_way(0) {}
     };
 
-    /** Shepherd-Cache specific necessary set data */
-    struct SCSetData 
+    /** Counters, pointers and timestamps of every set. */
+    mutable SCState state;
+
+    /**
+     * State read from a checkpoint. It is applied at startup, once the
+     * cache has reinserted its blocks, which resets their state.
+     */
+    struct
     {
-        /** 
-         * All shepherd cache related data structure within a single way in a given set
-         * Format for each entry:
-         * |   bit 7  | bit 6 |bit 5|bit 4|bit 3|bit 2|bit 1|bit 0|
-         * |Empty Flag|-----reserved------|------Count Value------| 
-         *   0 - Empty 
-         *   1 - Full  
-         * Number of bits for count value is based on what the total number of associativity
-         * is, and thus will use a mask to vary it. For this example, total associativity 
-         * including shepherd and main cache ways is 16, such that there are 4 shepherd
-         * cache ways total. */
-        std::vector<std::vector<uint8_t>> sc_data;
+        bool valid = false;
+        std::vector<Tick> tickInserted;
+        std::vector<Tick> tickAccessed;
+        std::vector<uint8_t> entryValid;
+        std::vector<uint8_t> entryReused;
+        std::vector<uint8_t> setData;
+    } restored;
+
+    /**
+     * Trace the counters, NVC and pointer of every SC way of a set, if it
+     * is traced.
+     *
+     * @param set The set index.
+     */
+    void traceSetState(int set) const;
+
+    /**
+     * Trace the insertion of an entry and account the SC way it promoted.
+     *
+     * @param set The set of the entry.
+     * @param way The way of the entry.
+     * @param fill How the Shepherd Cache state was updated.
+     */
+    void recordFill(int set, int way, const SCState::Fill &fill) const;
+
+    mutable struct SCStats : public statistics::Group
+    {
+        SCStats(statistics::Group* parent, int num_sc_ways);
+
+        /** Number of victims that were invalid entries. */
+        statistics::Scalar invalidVictims;
+
+        /** Number of victims selected by LRU among the empty counters. */
+        statistics::Scalar lruVictims;
+
+        /** Number of victims selected by the largest Shepherd Cache count. */
+        statistics::Scalar scVictims;
+
+        /** Number of times each SC way was pointed to a new entry. */
+        statistics::Vector promotions;
+
+        /** Count of the victims selected by the largest count. */
+        statistics::Histogram victimCounts;
+
+        /** Number of valid victims that were never reused. */
+        statistics::Scalar deadVictims;
+
+        /** Ratio of valid victims that were never reused. */
+        statistics::Formula deadVictimRatio;
+
+        /** Number of prefetches inserted as the next victim of their set. */
+        statistics::Scalar unconfidentPrefetches;
+    } scStats;
 
-        /**
-         * Next Value Counters within each set, vector length is determined by the number
-         * of Shepherd Cache ways
-         */
-        std::vector<uint8_t> sc_set_nvcs; 
-        
-        /**
-         * Vector storing which Shepherd Cache entry maps to which way of the cache,
-         * vector length is determined by the number of Shepherd Cache ways.
-         * [2, 4, 6, 8] means Shepherd Cache way 0 maps to way 2 within a set, so on
-         */
-        std::unordered_map<uint8_t, uint8_t> sc_way_ptr_map; 
-
-        SCSetData() : sc_data(0), sc_set_nvcs(0), sc_way_ptr_map(0) {}
-        SCSetData(int num_assoc, int num_sc_ways) {
-          this->sc_data.resize(num_assoc, std::vector<uint8_t>(num_sc_ways, 0));
-          for (int i = 0; i < num_sc_ways; i++) {
-            this->sc_way_ptr_map.insert({i, num_assoc - num_sc_ways + i});
-          }
-          this->sc_set_nvcs.resize(num_sc_ways, 0);
-        }
-    };
-    
-    /** Vector of the entire cache's worth of shepherd-cache set data */
-    mutable std::vector<SCSetData> set_data;
-    
   public:
     PARAMS(SCRP);
     SC(const Params &p);
@@ -123,7 +168,8 @@ class SC : public Base
 
     /**
      * Invalidate replacement data to set it as the next probable victim.
-     * Reset insertion tick to 0.
+     * Clears its timestamps, valid and reused flags, and marks it as
+     * empty in the column of every SC way.
      *
      * @param replacement_data Replacement data to be invalidated.
      */
@@ -141,13 +187,28 @@ class SC : public Base
 
     /**
      * Reset replacement data. Used when an entry is inserted.
-     * Sets its insertion tick.
+     * Sets its insertion tick, and points an SC way to it if the victim
+     * was selected by another policy, such as the other team of a
+     * set-dueling policy.
      *
      * @param replacement_data Replacement data to be reset.
      */
     void reset(const std::shared_ptr<ReplacementData>& replacement_data) const
                                                                      override;
 
+    /**
+     * Reset replacement data. Used when an entry is inserted. Unconfident
+     * prefetches are demoted to the next victim of their set: they are
+     * the least recently used entry, are not yet reused from the point of
+     * view of every SC way, and release the SC way that now points to
+     * them at the next replacement.
+     *
+     * @param replacement_data Replacement data to be reset.
+     * @param pkt Packet that generated this miss.
+     */
+    void reset(const std::shared_ptr<ReplacementData>& replacement_data,
+               const PacketPtr pkt) override;
+
     /**
      * Find replacement victim using insertion timestamps.
      *
@@ -158,11 +219,29 @@ class SC : public Base
                                                                      override;
 
     /**
-     * Instantiate a replacement data entry.
+     * Instantiate a replacement data entry. Not supported: the Shepherd
+     * Cache needs the position of its entries, which only
+     * instantiateEntries() provides.
      *
      * @return A shared pointer to the new replacement data.
      */
     std::shared_ptr<ReplacementData> instantiateEntry() override;
+
+    /**
+     * Size the per-set Shepherd Cache state for the table and instantiate
+     * the replacement data of its entries in a single arena, recording
+     * the set and way of every entry.
+     *
+     * @param num_sets Number of sets of the table.
+     * @param assoc Associativity of the table.
+     * @return Shared pointers to the replacement data of every entry.
+     */
+    std::vector<std::shared_ptr<ReplacementData>>
+    instantiateEntries(std::size_t num_sets, std::size_t assoc) override;
+
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
+    void startup() override;
 };
 
 } // namespace replacement_policy
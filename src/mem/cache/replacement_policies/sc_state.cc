@@ -0,0 +1,454 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/replacement_policies/sc_state.hh"
+
+#include <algorithm>
+#include <cassert>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "mem/cache/replacement_policies/victim_select.hh"
+
+namespace gem5
+{
+
+GEM5_DEPRECATED_NAMESPACE(ReplacementPolicy, replacement_policy);
+namespace replacement_policy
+{
+
+SCState::SCState(int num_sc_ways, unsigned counter_bits)
+  : num_sc_ways(num_sc_ways), num_assoc(0), num_sets(0),
+    counterBitsParam(counter_bits), counterBits(0), linesPerSet(0)
+{
+    fatal_if(num_sc_ways < 0, "The number of Shepherd Cache ways must not "
+             "be negative\n");
+    fatal_if(counterBitsParam != 0 && counterBitsParam != 8 &&
+             counterBitsParam != 16 && counterBitsParam != 32,
+             "Shepherd Cache counters must be 8, 16 or 32 bits wide, or 0 "
+             "to size them from the associativity\n");
+}
+
+void
+SCState::init(int sets, int assoc)
+{
+    fatal_if(assoc < num_sc_ways, "The associativity (%d) must be at least "
+             "the number of Shepherd Cache ways (%d)\n", assoc, num_sc_ways);
+
+    num_assoc = assoc;
+    num_sets = sets;
+
+    // Use the narrowest counters that can count up to the associativity,
+    // unless a width was requested
+    if (counterBitsParam) {
+        counterBits = counterBitsParam;
+    } else if (Counter<uint8_t>::fits(num_assoc)) {
+        counterBits = 8;
+    } else if (Counter<uint16_t>::fits(num_assoc)) {
+        counterBits = 16;
+    } else {
+        counterBits = 32;
+    }
+    fatal_if(counterBits < 32 &&
+             num_assoc - 1 >= (1 << (counterBits - 1)),
+             "%d-bit Shepherd Cache counters cannot count up to the "
+             "associativity (%d)\n", counterBits, num_assoc);
+
+    tickInserted.assign(num_sets * num_assoc, 0);
+    tickAccessed.assign(num_sets * num_assoc, 0);
+    entryValid.assign(num_sets * num_assoc, 0);
+    entryReused.assign(num_sets * num_assoc, 0);
+    skewedTickInserted.resize(num_assoc);
+    skewedTickAccessed.resize(num_assoc);
+    skewedEntryValid.resize(num_assoc);
+    scTicks.resize(num_sc_ways);
+
+    switch (counterBits) {
+      case 8:
+        initSetData<uint8_t>();
+        break;
+      case 16:
+        initSetData<uint16_t>();
+        break;
+      default:
+        initSetData<uint32_t>();
+        break;
+    }
+}
+
+template <typename T>
+void
+SCState::initSetData()
+{
+    // Counters, NVCs and SC-way pointers of a set are packed together
+    const std::size_t bytes_per_set =
+        sizeof(T) * num_sc_ways * (num_assoc + 2);
+    linesPerSet = divCeil(bytes_per_set, SetLineSize);
+    set_data.assign(num_sets * linesPerSet, SCSetLine());
+
+    for (int set = 0; set < num_sets; set++) {
+        SCSetData<T> data = getSetData<T>(set);
+        std::fill(data.counters, data.counters + num_sc_ways * num_assoc, 0);
+        std::fill(data.nvcs, data.nvcs + num_sc_ways, 0);
+        for (int i = 0; i < num_sc_ways; i++) {
+            data.sc_way_ptrs[i] = num_assoc - num_sc_ways + i;
+        }
+    }
+}
+
+void
+SCState::touch(int set, int way, Tick tick)
+{
+    // Touched the entry, LRU tick needs update
+    const int entry_idx = set * num_assoc + way;
+    tickAccessed[entry_idx] = tick;
+    entryReused[entry_idx] = true;
+
+    switch (counterBits) {
+      case 8:
+        touchImpl<uint8_t>(set, way);
+        break;
+      case 16:
+        touchImpl<uint16_t>(set, way);
+        break;
+      default:
+        touchImpl<uint32_t>(set, way);
+        break;
+    }
+}
+
+template <typename T>
+void
+SCState::touchImpl(int set, int way)
+{
+    /**
+     * Search through all the SC entries and find which SC-way's counter and
+     * NVC needs to be updated. If the entry is empty then copy previous NVC
+     * value to the counter and increment NVC by 1, otherwise preserve the
+     * value and don't increment NVC
+     */
+    SCSetData<T> data = getSetData<T>(set);
+    T *counter = data.counters + way;
+    for (int i = 0; i < num_sc_ways; i++, counter += num_assoc) {
+        if (!(*counter & Counter<T>::FullFlag)) {
+            *counter = Counter<T>::FullFlag |
+                (data.nvcs[i] & Counter<T>::CountMask);
+            data.nvcs[i] += 1;
+        }
+    }
+}
+
+SCState::Fill
+SCState::reset(int set, int way, Tick tick)
+{
+    const int entry_idx = set * num_assoc + way;
+    const bool was_valid = entryValid[entry_idx];
+    tickInserted[entry_idx] = tick;
+    // LRU Tick also needs update
+    tickAccessed[entry_idx] = tick;
+    entryValid[entry_idx] = true;
+    entryReused[entry_idx] = false;
+
+    switch (counterBits) {
+      case 8:
+        return resetImpl<uint8_t>(set, way, was_valid);
+      case 16:
+        return resetImpl<uint16_t>(set, way, was_valid);
+      default:
+        return resetImpl<uint32_t>(set, way, was_valid);
+    }
+}
+
+template <typename T>
+SCState::Fill
+SCState::resetImpl(int set, int way, bool was_valid)
+{
+    /**
+     * When reset is called, this means that we are inserting a new entry
+     * into the cache, whether if it's through replacement or just populating
+     * the cache initially. We clear whichever SC-way's sc_data to all empty
+     * and set all the counters along the way to 0
+     */
+    Fill fill{-1, false, -1};
+    SCSetData<T> data = getSetData<T>(set);
+    fill.scWay = std::find(data.sc_way_ptrs, data.sc_way_ptrs + num_sc_ways,
+                           T(way)) - data.sc_way_ptrs;
+
+    /**
+     * Victim selection points an SC way to every valid victim it selects.
+     * A valid entry that no SC way points to was therefore selected by
+     * another policy: do what victim selection would have done, and point
+     * the SC way whose entry is the oldest to it. Otherwise its column
+     * would keep the reuse order of an entry that is no longer there.
+     */
+    if (fill.scWay == num_sc_ways && was_valid && num_sc_ways > 0) {
+        const int set_base = set * num_assoc;
+        for (int i = 0; i < num_sc_ways; i++) {
+            scTicks[i] = tickInserted[set_base + data.sc_way_ptrs[i]];
+        }
+        fill.scWay = findFirstMin(scTicks.data(), num_sc_ways);
+        fill.repointed = true;
+        fill.oldPtr = data.sc_way_ptrs[fill.scWay];
+        data.sc_way_ptrs[fill.scWay] = way;
+    }
+
+    // Only do it if it found an SC way, otherwise do nothing
+    if (fill.scWay < num_sc_ways) {
+        // Mark this way as full in every SC-way's column...
+        T *counter = data.counters + way;
+        for (int i = 0; i < num_sc_ways; i++, counter += num_assoc) {
+            *counter = Counter<T>::FullFlag;
+        }
+        // ...then clear the whole column of the found SC entry
+        T *column = data.counters + fill.scWay * num_assoc;
+        std::fill(column, column + num_assoc, 0);
+        data.nvcs[fill.scWay] = 0;
+    } else {
+        fill.scWay = -1;
+    }
+    return fill;
+}
+
+void
+SCState::demote(int set, int way)
+{
+    // The oldest entries are the first LRU victims, and the oldest SC way
+    // is the first to be reused
+    const int entry_idx = set * num_assoc + way;
+    tickInserted[entry_idx] = Tick(0);
+    tickAccessed[entry_idx] = Tick(0);
+
+    switch (counterBits) {
+      case 8:
+        clearColumnsImpl<uint8_t>(set, way);
+        break;
+      case 16:
+        clearColumnsImpl<uint16_t>(set, way);
+        break;
+      default:
+        clearColumnsImpl<uint32_t>(set, way);
+        break;
+    }
+}
+
+void
+SCState::invalidate(int set, int way)
+{
+    // The entry becomes the first victim of its set, and it is no longer
+    // accounted as a live or dead block
+    const int entry_idx = set * num_assoc + way;
+    tickInserted[entry_idx] = Tick(0);
+    tickAccessed[entry_idx] = Tick(0);
+    entryValid[entry_idx] = false;
+    entryReused[entry_idx] = false;
+
+    switch (counterBits) {
+      case 8:
+        clearColumnsImpl<uint8_t>(set, way);
+        break;
+      case 16:
+        clearColumnsImpl<uint16_t>(set, way);
+        break;
+      default:
+        clearColumnsImpl<uint32_t>(set, way);
+        break;
+    }
+}
+
+template <typename T>
+void
+SCState::clearColumnsImpl(int set, int way)
+{
+    // Mark the entry as empty in every SC way's column, so that it is an
+    // LRU candidate whichever SC way is used for the next replacement
+    SCSetData<T> data = getSetData<T>(set);
+    T *counter = data.counters + way;
+    for (int i = 0; i < num_sc_ways; i++, counter += num_assoc) {
+        *counter = 0;
+    }
+}
+
+SCState::Victim
+SCState::getVictim(const std::vector<ReplaceableEntry*>& candidates)
+{
+    // There must be one replacement candidate per way
+    assert(candidates.size() == num_assoc);
+
+    const int set_num = candidates[0]->getSet();
+    const int set_base = set_num * num_assoc;
+
+    /**
+     * With set associative indexing every candidate belongs to the same set,
+     * whose state is contiguous. With skewed indexing each way comes from a
+     * different row, so gather the state of the candidates instead.
+     */
+    const Tick *inserted = &tickInserted[set_base];
+    const Tick *accessed = &tickAccessed[set_base];
+    const uint8_t *valid = &entryValid[set_base];
+    const bool same_set = std::all_of(candidates.begin(), candidates.end(),
+        [set_num](const ReplaceableEntry* candidate)
+        { return candidate->getSet() == set_num; });
+    if (!same_set) {
+        for (int j = 0; j < num_assoc; j++) {
+            const int entry_idx = candidates[j]->getSet() * num_assoc + j;
+            skewedTickInserted[j] = tickInserted[entry_idx];
+            skewedTickAccessed[j] = tickAccessed[entry_idx];
+            skewedEntryValid[j] = entryValid[entry_idx];
+        }
+        inserted = skewedTickInserted.data();
+        accessed = skewedTickAccessed.data();
+        valid = skewedEntryValid.data();
+    }
+
+    Victim victim{0, VictimSource::Invalid, -1, -1, 0, false};
+
+    /**
+     * Handle compulsory misses by finding the first invalid block
+     */
+    const int invalid_way = findFirstClear(valid, 1, num_assoc);
+    if (invalid_way < num_assoc) {
+        victim.index = invalid_way;
+        return victim;
+    }
+
+    if (num_sc_ways == 0) {
+        // Without Shepherd Cache ways the policy degenerates into LRU
+        victim.source = VictimSource::LRU;
+        victim.index = findFirstMin(accessed, num_assoc);
+    } else {
+        switch (counterBits) {
+          case 8:
+            getVictimImpl<uint8_t>(victim, candidates, set_num, inserted,
+                                   accessed);
+            break;
+          case 16:
+            getVictimImpl<uint16_t>(victim, candidates, set_num, inserted,
+                                    accessed);
+            break;
+          default:
+            getVictimImpl<uint32_t>(victim, candidates, set_num, inserted,
+                                    accessed);
+            break;
+        }
+    }
+
+    const ReplaceableEntry* entry = candidates[victim.index];
+    victim.reused =
+        entryReused[entry->getSet() * num_assoc + entry->getWay()];
+    return victim;
+}
+
+template <typename T>
+void
+SCState::getVictimImpl(Victim &victim,
+                       const std::vector<ReplaceableEntry*>& candidates,
+                       int set_num, const Tick *inserted,
+                       const Tick *accessed)
+{
+    /**
+     * There are no empty blocks remaining, check within shepherd cache
+     * to find the right victim to replace, use FIFO to determine which
+     * shepherd cache entry will be used to replace things
+     */
+    SCSetData<T> data = getSetData<T>(set_num);
+    for (int i = 0; i < num_sc_ways; i++) {
+        scTicks[i] = inserted[data.sc_way_ptrs[i]];
+    }
+    const int sc_way_num = findFirstMin(scTicks.data(), num_sc_ways);
+
+    /**
+     * Use the found Shepherd Cache entry to perform replacement on the rest
+     * of the cache block, using LRU within the empty items if all counters
+     * aren't full and otherwise find the largest count and return that as
+     * the candidate of replacement
+     */
+    const T *column = data.counters + sc_way_num * num_assoc;
+    if (findFirstClear(column, Counter<T>::FullFlag, num_assoc) <
+        num_assoc) {
+        // Detected an empty flag, perform LRU among the empty entries
+        victim.source = VictimSource::LRU;
+        victim.index = findFirstMinIf(accessed, column, Counter<T>::FullFlag,
+                                      num_assoc);
+    } else {
+        // Find the way with the maximum count and save its index
+        victim.source = VictimSource::SC;
+        victim.index = findFirstMax(column, Counter<T>::CountMask,
+                                    num_assoc);
+        victim.count = column[victim.index] & Counter<T>::CountMask;
+    }
+
+    /**
+     * Upon replacement, the SC way is pointed to the victim, whose column
+     * is cleared when the new entry is inserted
+     */
+    victim.scWay = sc_way_num;
+    victim.oldPtr = data.sc_way_ptrs[sc_way_num];
+    data.sc_way_ptrs[sc_way_num] = candidates[victim.index]->getWay();
+}
+
+unsigned
+SCState::readSetData(int set, int offset) const
+{
+    switch (counterBits) {
+      case 8:
+        return readSetData<uint8_t>(set, offset);
+      case 16:
+        return readSetData<uint16_t>(set, offset);
+      default:
+        return readSetData<uint32_t>(set, offset);
+    }
+}
+
+int
+SCState::pointer(int set, int sc_way) const
+{
+    return readSetData(set, num_sc_ways * (num_assoc + 1) + sc_way);
+}
+
+unsigned
+SCState::nvc(int set, int sc_way) const
+{
+    return readSetData(set, num_sc_ways * num_assoc + sc_way);
+}
+
+bool
+SCState::isFull(int set, int sc_way, int way) const
+{
+    // The full flag is the most significant bit of the counter
+    return readSetData(set, sc_way * num_assoc + way) >> (counterBits - 1);
+}
+
+unsigned
+SCState::count(int set, int sc_way, int way) const
+{
+    const unsigned counter = readSetData(set, sc_way * num_assoc + way);
+    return counter & ((1ULL << (counterBits - 1)) - 1);
+}
+
+} // namespace replacement_policy
+} // namespace gem5
@@ -0,0 +1,387 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Per-set state of the Shepherd Cache replacement policy. It holds the
+ * counters, next value counters and SC-way pointers of every set, and the
+ * timestamps and flags of every entry, and implements their transitions.
+ * It does not depend on the simulator, so the policy only adds statistics
+ * and tracing on top of it.
+ */
+
+#ifndef __MEM_CACHE_REPLACEMENT_POLICIES_SC_STATE_HH__
+#define __MEM_CACHE_REPLACEMENT_POLICIES_SC_STATE_HH__
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "base/compiler.hh"
+#include "base/types.hh"
+#include "mem/cache/replacement_policies/replaceable_entry.hh"
+
+namespace gem5
+{
+
+GEM5_DEPRECATED_NAMESPACE(ReplacementPolicy, replacement_policy);
+namespace replacement_policy
+{
+
+class SCState
+{
+  public:
+    /**
+     * Encoding of the Shepherd Cache counters for a storage width. The most
+     * significant bit is the full flag, and the remaining bits hold the
+     * count value. The NVCs and SC-way pointers are stored with the same
+     * width, as they hold values of the same range.
+     *
+     * @tparam T Unsigned storage type of the counters.
+     */
+    template <typename T>
+    struct Counter
+    {
+        static_assert(std::is_unsigned_v<T>,
+                      "Shepherd Cache counters must be unsigned");
+
+        /** Set when the entry is full, clear when it is empty. */
+        static constexpr T FullFlag = T(1) << (sizeof(T) * 8 - 1);
+
+        /** Bits holding the count value. */
+        static constexpr T CountMask = FullFlag - 1;
+
+        /**
+         * Whether the counters can represent a set of the given
+         * associativity: counts and SC-way pointers never exceed
+         * assoc - 1, and NVCs never exceed assoc.
+         */
+        static constexpr bool
+        fits(std::size_t assoc)
+        {
+            return assoc - 1 <= CountMask;
+        }
+    };
+
+    /**
+     * Host cache line size used to pad the per-set Shepherd Cache state, so
+     * that the state of a set never straddles more lines than necessary.
+     */
+    static constexpr std::size_t SetLineSize = 64;
+
+    /** Storage unit of the per-set Shepherd Cache state. */
+    struct alignas(SetLineSize) SCSetLine
+    {
+        uint8_t bytes[SetLineSize];
+    };
+
+    /**
+     * View of the Shepherd Cache state of a single set. All the arrays live
+     * in one contiguous, line-aligned block of set_data:
+     *
+     * | counters (num_sc_ways x num_assoc) | nvcs (num_sc_ways) |
+     * | sc_way_ptrs (num_sc_ways) | padding up to a host line boundary |
+     *
+     * Each counter entry uses the following format, where N is the width
+     * of the counters:
+     * |  bit N-1  | bits N-2 .. 0 |
+     * | Full Flag |  Count Value  |
+     *   0 - Empty
+     *   1 - Full
+     *
+     * @tparam T Unsigned storage type of the counters.
+     */
+    template <typename T>
+    struct SCSetData
+    {
+        /**
+         * Counters, stored SC-way major: the column of SC-way i starts at
+         * counters[i * num_assoc], so victim selection, which scans one
+         * SC-way across every cache way, walks consecutive elements.
+         */
+        T *counters;
+
+        /** Next Value Counters, one per Shepherd Cache way. */
+        T *nvcs;
+
+        /**
+         * Cache way each Shepherd Cache way maps to. {2, 4, 6, 8} means
+         * Shepherd Cache way 0 maps to way 2 within a set, and so on.
+         */
+        T *sc_way_ptrs;
+    };
+
+    /** How a victim was selected. */
+    enum class VictimSource
+    {
+        /** The first invalid entry of the set. */
+        Invalid,
+        /** LRU among the entries whose counter is empty. */
+        LRU,
+        /** The entry with the largest count. */
+        SC
+    };
+
+    /** Outcome of a victim selection. */
+    struct Victim
+    {
+        /** Index of the victim among the candidates. */
+        int index;
+
+        VictimSource source;
+
+        /** SC way pointed to the victim, or -1 if none was. */
+        int scWay;
+
+        /** Way the SC way pointed to before the selection. */
+        int oldPtr;
+
+        /** Count of the victim, when selected by the largest count. */
+        unsigned count;
+
+        /** Whether the victim was reused since it was inserted. */
+        bool reused;
+    };
+
+    /** Outcome of a fill. */
+    struct Fill
+    {
+        /** SC way that points to the filled entry, or -1 if none does. */
+        int scWay;
+
+        /**
+         * Whether the SC way was pointed to the entry by the fill, because
+         * the victim was selected by another policy.
+         */
+        bool repointed;
+
+        /** Way the SC way pointed to before the fill, if repointed. */
+        int oldPtr;
+    };
+
+    /** Number of SC Ways passed in as parameter */
+    const int num_sc_ways;
+
+    /** Cache structure info */
+    int num_assoc;
+    int num_sets;
+
+    /**
+     * Width of the counters, in bits, as passed in as parameter. 0 selects
+     * the narrowest width that fits the associativity.
+     */
+    const unsigned counterBitsParam;
+
+    /** Width of the counters in use, in bits: 8, 16 or 32. */
+    unsigned counterBits;
+
+    /**
+     * Tick on which each entry was inserted, and on which it was last
+     * accessed, indexed by set * num_assoc + way. Keeping a set's
+     * timestamps contiguous lets victim selection use vector reductions.
+     */
+    std::vector<Tick> tickInserted;
+    std::vector<Tick> tickAccessed;
+
+    /** Whether each entry holds valid data, indexed like the timestamps. */
+    std::vector<uint8_t> entryValid;
+
+    /**
+     * Whether each entry has been touched since it was inserted, indexed
+     * like the timestamps. Victims that were never reused are dead blocks.
+     */
+    std::vector<uint8_t> entryReused;
+
+    /** Number of SCSetLine used by the state of each set. */
+    std::size_t linesPerSet;
+
+    /** The entire cache's worth of packed shepherd-cache set data. */
+    std::vector<SCSetLine> set_data;
+
+    /**
+     * @param num_sc_ways Number of Shepherd Cache ways of each set.
+     * @param counter_bits Width of the counters, or 0 to size them from
+     *        the associativity.
+     */
+    SCState(int num_sc_ways, unsigned counter_bits);
+
+    /**
+     * Size the state for the given cache geometry and reset it: every
+     * entry invalid, every counter empty, every NVC 0, and the Shepherd
+     * Cache ways pointing to the last num_sc_ways ways of each set. This
+     * also selects the width of the counters.
+     *
+     * @param sets Number of sets of the cache.
+     * @param assoc Associativity of the cache.
+     */
+    void init(int sets, int assoc);
+
+    /**
+     * Record a hit on an entry: it becomes the most recently used entry,
+     * and it is marked as full in the column of every SC way for which it
+     * was still empty, with the next value of that SC way.
+     *
+     * @param set The set of the entry.
+     * @param way The way of the entry.
+     * @param tick The current tick.
+     */
+    void touch(int set, int way, Tick tick);
+
+    /**
+     * Record the insertion of an entry. The SC way that points to it has
+     * its column cleared, and the entry is marked as full in every other
+     * column. When the victim was selected by another policy, e.g. by the
+     * other team of a set-dueling policy, no SC way points to it yet: the
+     * SC way pointing to the oldest entry is pointed to it first, as if
+     * it had selected it.
+     *
+     * @param set The set of the entry.
+     * @param way The way of the entry.
+     * @param tick The current tick.
+     * @return The SC way pointing to the entry, if any.
+     */
+    Fill reset(int set, int way, Tick tick);
+
+    /**
+     * Make an entry the next victim of its set: the least recently used
+     * entry, which is empty in the column of every SC way.
+     *
+     * @param set The set of the entry.
+     * @param way The way of the entry.
+     */
+    void demote(int set, int way);
+
+    /**
+     * Invalidate an entry. It is no longer valid nor reused, and it is
+     * empty in the column of every SC way. An SC way that points to it
+     * keeps doing so, and its column is cleared when the entry is filled.
+     *
+     * @param set The set of the entry.
+     * @param way The way of the entry.
+     */
+    void invalidate(int set, int way);
+
+    /**
+     * Select a victim among the entries of a set: the first invalid
+     * entry, if any, and otherwise the choice of the SC way pointing to
+     * the oldest entry, which is then pointed to the victim.
+     *
+     * The candidates of a skewed cache do not belong to the same set. The
+     * counters and SC-way pointers of the first candidate's row are used
+     * then, which makes Shepherd Cache an approximation on skewed caches.
+     *
+     * @param candidates One candidate per way.
+     * @return The victim and how it was selected.
+     */
+    Victim getVictim(const std::vector<ReplaceableEntry*>& candidates);
+
+    /**
+     * @{
+     * Read the state of the Shepherd Cache way sc_way of a set, whatever
+     * the width of the counters.
+     */
+    int pointer(int set, int sc_way) const;
+    unsigned nvc(int set, int sc_way) const;
+    bool isFull(int set, int sc_way, int way) const;
+    unsigned count(int set, int sc_way, int way) const;
+    /** @} */
+
+  private:
+    /**
+     * Scratch copies of the timestamps and valid flags of the candidates,
+     * used when they do not belong to the same set (skewed indexing).
+     */
+    std::vector<Tick> skewedTickInserted;
+    std::vector<Tick> skewedTickAccessed;
+    std::vector<uint8_t> skewedEntryValid;
+
+    /** Scratch insertion ticks of the entries the SC ways point to. */
+    std::vector<Tick> scTicks;
+
+    /**
+     * Get a view of the Shepherd Cache state of a set.
+     *
+     * @tparam T Unsigned storage type of the counters.
+     * @param set The set index.
+     * @return Pointers to the counters, NVCs and SC-way pointers of the set.
+     */
+    template <typename T>
+    SCSetData<T>
+    getSetData(int set)
+    {
+        T *base = reinterpret_cast<T *>(set_data[set * linesPerSet].bytes);
+        T *nvcs = base + num_sc_ways * num_assoc;
+        return SCSetData<T>{base, nvcs, nvcs + num_sc_ways};
+    }
+
+    /**
+     * Read the value at an offset of the Shepherd Cache state of a set.
+     *
+     * @tparam T Unsigned storage type of the counters.
+     * @param set The set index.
+     * @param offset Offset of the value, in counters.
+     */
+    template <typename T>
+    T
+    readSetData(int set, int offset) const
+    {
+        return reinterpret_cast<const T *>(
+            set_data[set * linesPerSet].bytes)[offset];
+    }
+
+    /** Read the value at an offset of the state of a set, at any width. */
+    unsigned readSetData(int set, int offset) const;
+
+    /**
+     * @{
+     * Implementations of the transitions for a given counter width.
+     */
+    template <typename T>
+    void initSetData();
+
+    template <typename T>
+    void touchImpl(int set, int way);
+
+    template <typename T>
+    Fill resetImpl(int set, int way, bool was_valid);
+
+    template <typename T>
+    void clearColumnsImpl(int set, int way);
+
+    template <typename T>
+    void getVictimImpl(Victim &victim,
+                       const std::vector<ReplaceableEntry*>& candidates,
+                       int set, const Tick *inserted, const Tick *accessed);
+    /** @} */
+};
+
+} // namespace replacement_policy
+} // namespace gem5
+
+#endif // __MEM_CACHE_REPLACEMENT_POLICIES_SC_STATE_HH__
@@ -0,0 +1,313 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "base/types.hh"
+#include "mem/cache/replacement_policies/replaceable_entry.hh"
+#include "mem/cache/replacement_policies/sc_state.hh"
+
+using namespace gem5;
+using replacement_policy::SCState;
+
+namespace
+{
+
+/** The entries of a small set associative table. */
+class Table
+{
+  public:
+    Table(int sets, int assoc)
+      : entries(sets * assoc)
+    {
+        for (int i = 0; i < sets * assoc; i++) {
+            entries[i].setPosition(i / assoc, i % assoc);
+        }
+        for (int set = 0; set < sets; set++) {
+            std::vector<ReplaceableEntry*> set_candidates;
+            for (int way = 0; way < assoc; way++) {
+                set_candidates.push_back(&entries[set * assoc + way]);
+            }
+            candidates.push_back(set_candidates);
+        }
+    }
+
+    std::vector<ReplaceableEntry> entries;
+    std::vector<std::vector<ReplaceableEntry*>> candidates;
+};
+
+/** Fill every way of set 0, in order, at ticks 1 to assoc. */
+void
+warmUp(SCState &state, Table &table, Tick &tick)
+{
+    for (int way = 0; way < state.num_assoc; way++) {
+        const SCState::Victim victim =
+            state.getVictim(table.candidates[0]);
+        ASSERT_EQ(victim.source, SCState::VictimSource::Invalid);
+        ASSERT_EQ(victim.index, way);
+        state.reset(0, way, ++tick);
+    }
+}
+
+/**
+ * Check that the column of every SC way records the reuse order since
+ * its entry was inserted: a way is full if, and only if, it was touched or
+ * filled after the entry the SC way points to.
+ */
+void
+checkColumns(const SCState &state, int set)
+{
+    const int set_base = set * state.num_assoc;
+    for (int i = 0; i < state.num_sc_ways; i++) {
+        const int ptr = state.pointer(set, i);
+        const Tick inserted = state.tickInserted[set_base + ptr];
+        for (int way = 0; way < state.num_assoc; way++) {
+            ASSERT_EQ(state.isFull(set, i, way),
+                      state.tickAccessed[set_base + way] > inserted)
+                << "sc_way=" << i << " ptr=" << ptr << " way=" << way;
+        }
+    }
+}
+
+} // anonymous namespace
+
+TEST(SCStateTest, Init)
+{
+    SCState state(2, 0);
+    state.init(4, 8);
+    ASSERT_EQ(state.counterBits, 8);
+    for (int set = 0; set < 4; set++) {
+        for (int i = 0; i < 2; i++) {
+            ASSERT_EQ(state.pointer(set, i), 6 + i);
+            ASSERT_EQ(state.nvc(set, i), 0);
+            for (int way = 0; way < 8; way++) {
+                ASSERT_FALSE(state.isFull(set, i, way));
+            }
+        }
+    }
+
+    // The counters are widened when the count does not fit
+    SCState wide(2, 0);
+    wide.init(1, 200);
+    ASSERT_EQ(wide.counterBits, 16);
+}
+
+TEST(SCStateTest, TouchAssignsNextValues)
+{
+    Table table(1, 8);
+    SCState state(2, 0);
+    state.init(1, 8);
+    Tick tick = 0;
+    warmUp(state, table, tick);
+
+    // The fills of the entries of SC ways 0 and 1 cleared their columns,
+    // and way 7 was filled after the entry of SC way 0
+    for (int way = 0; way < 8; way++) {
+        ASSERT_EQ(state.isFull(0, 0, way), way == 7);
+        ASSERT_FALSE(state.isFull(0, 1, way));
+    }
+
+    state.touch(0, 2, ++tick);
+    state.touch(0, 5, ++tick);
+    state.touch(0, 2, ++tick);
+    for (int i = 0; i < 2; i++) {
+        ASSERT_TRUE(state.isFull(0, i, 2));
+        ASSERT_EQ(state.count(0, i, 2), 0);
+        ASSERT_TRUE(state.isFull(0, i, 5));
+        ASSERT_EQ(state.count(0, i, 5), 1);
+        ASSERT_EQ(state.nvc(0, i), 2);
+    }
+    checkColumns(state, 0);
+}
+
+TEST(SCStateTest, VictimSelectionPointsSCWay)
+{
+    Table table(1, 8);
+    SCState state(2, 0);
+    state.init(1, 8);
+    Tick tick = 0;
+    warmUp(state, table, tick);
+    state.touch(0, 0, ++tick);
+    state.touch(0, 2, ++tick);
+
+    // SC way 0 points to the oldest entry, and its least recently used
+    // empty way is way 1
+    const SCState::Victim victim = state.getVictim(table.candidates[0]);
+    ASSERT_EQ(victim.source, SCState::VictimSource::LRU);
+    ASSERT_EQ(victim.index, 1);
+    ASSERT_EQ(victim.scWay, 0);
+    ASSERT_EQ(victim.oldPtr, 6);
+    ASSERT_FALSE(victim.reused);
+    ASSERT_EQ(state.pointer(0, 0), 1);
+
+    const SCState::Fill fill = state.reset(0, 1, ++tick);
+    ASSERT_EQ(fill.scWay, 0);
+    ASSERT_FALSE(fill.repointed);
+    ASSERT_EQ(state.nvc(0, 0), 0);
+    ASSERT_TRUE(state.isFull(0, 1, 1));
+    checkColumns(state, 0);
+}
+
+TEST(SCStateTest, FullColumnSelectsLargestCount)
+{
+    Table table(1, 4);
+    SCState state(1, 0);
+    state.init(1, 4);
+    Tick tick = 0;
+    warmUp(state, table, tick);
+
+    // Every way is reused after the entry of the SC way, way 1 last
+    state.touch(0, 3, ++tick);
+    state.touch(0, 0, ++tick);
+    state.touch(0, 2, ++tick);
+    state.touch(0, 1, ++tick);
+    const SCState::Victim victim = state.getVictim(table.candidates[0]);
+    ASSERT_EQ(victim.source, SCState::VictimSource::SC);
+    ASSERT_EQ(victim.index, 1);
+    ASSERT_EQ(victim.count, 3);
+    ASSERT_TRUE(victim.reused);
+}
+
+/**
+ * A victim selected by another policy, such as the other team of a
+ * set-dueling policy, points the SC way of the oldest entry to it.
+ */
+TEST(SCStateTest, ForeignVictimPointsOldestSCWay)
+{
+    Table table(1, 8);
+    SCState state(2, 0);
+    state.init(1, 8);
+    Tick tick = 0;
+    warmUp(state, table, tick);
+    state.touch(0, 4, ++tick);
+
+    // Way 3 was selected without the Shepherd Cache
+    const SCState::Fill fill = state.reset(0, 3, ++tick);
+    ASSERT_TRUE(fill.repointed);
+    ASSERT_EQ(fill.scWay, 0);
+    ASSERT_EQ(fill.oldPtr, 6);
+    ASSERT_EQ(state.pointer(0, 0), 3);
+    ASSERT_EQ(state.pointer(0, 1), 7);
+    ASSERT_EQ(state.nvc(0, 0), 0);
+    for (int way = 0; way < 8; way++) {
+        ASSERT_FALSE(state.isFull(0, 0, way));
+    }
+    ASSERT_TRUE(state.isFull(0, 1, 3));
+    checkColumns(state, 0);
+
+    // The next foreign victim goes to the SC way that is now the oldest
+    const SCState::Fill next = state.reset(0, 5, ++tick);
+    ASSERT_TRUE(next.repointed);
+    ASSERT_EQ(next.scWay, 1);
+    checkColumns(state, 0);
+}
+
+TEST(SCStateTest, InvalidateClearsEntry)
+{
+    Table table(1, 8);
+    SCState state(2, 0);
+    state.init(1, 8);
+    Tick tick = 0;
+    warmUp(state, table, tick);
+    state.touch(0, 4, ++tick);
+
+    state.invalidate(0, 4);
+    ASSERT_FALSE(state.entryValid[4]);
+    ASSERT_FALSE(state.entryReused[4]);
+    for (int i = 0; i < 2; i++) {
+        ASSERT_FALSE(state.isFull(0, i, 4));
+    }
+
+    // The invalid entry is the next victim, and filling it does not
+    // point any SC way to it
+    const SCState::Victim victim = state.getVictim(table.candidates[0]);
+    ASSERT_EQ(victim.source, SCState::VictimSource::Invalid);
+    ASSERT_EQ(victim.index, 4);
+    const SCState::Fill fill = state.reset(0, 4, ++tick);
+    ASSERT_EQ(fill.scWay, -1);
+    ASSERT_FALSE(fill.repointed);
+}
+
+/**
+ * Emulate the follower sets of a set-dueling policy: every victim is
+ * selected by one of two Shepherd Caches with different numbers of SC
+ * ways, or by LRU, and every fill and touch updates both. Whichever
+ * policy selects the victims, the columns of both must stay consistent.
+ */
+TEST(SCStateTest, DuelingFollowers)
+{
+    const int assoc = 8;
+    Table table(1, assoc);
+    SCState narrow(2, 0);
+    SCState wide(4, 0);
+    narrow.init(1, assoc);
+    wide.init(1, assoc);
+    Tick tick = 0;
+    warmUp(narrow, table, tick);
+    tick = 0;
+    warmUp(wide, table, tick);
+
+    std::mt19937 gen(1);
+    for (int iter = 0; iter < 20000; iter++) {
+        tick++;
+        if (gen() % 8 < 5) {
+            const int way = gen() % assoc;
+            narrow.touch(0, way, tick);
+            wide.touch(0, way, tick);
+            continue;
+        }
+
+        int victim;
+        switch (gen() % 3) {
+          case 0:
+            victim = narrow.getVictim(table.candidates[0]).index;
+            break;
+          case 1:
+            victim = wide.getVictim(table.candidates[0]).index;
+            break;
+          default:
+            victim = 0;
+            for (int way = 1; way < assoc; way++) {
+                if (narrow.tickAccessed[way] <
+                    narrow.tickAccessed[victim]) {
+                    victim = way;
+                }
+            }
+            break;
+        }
+        narrow.reset(0, victim, tick);
+        wide.reset(0, victim, tick);
+        checkColumns(narrow, 0);
+        checkColumns(wide, 0);
+    }
+}
@@ -138,5 +138,11 @@ SecondChance::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new SecondChanceReplData());
 }
 
+std::vector<std::shared_ptr<ReplacementData>>
+SecondChance::instantiateEntries(std::size_t num_sets, std::size_t assoc)
+{
+    return makeArena<SecondChanceReplData>(num_sets * assoc);
+}
+
 } // namespace replacement_policy
 } // namespace gem5
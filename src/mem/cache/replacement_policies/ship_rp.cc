@@ -127,9 +127,12 @@ SHiP::reset(const std::shared_ptr<ReplacementData>& replacement_data,
     casted_replacement_data->setSignature(signature);
 
     // If SHCT for signature is set, predict intermediate re-reference.
-    // Predict distant re-reference otherwise
+    // Predict distant re-reference otherwise. Unconfident prefetches are
+    // always predicted distant re-reference
     BRRIP::reset(replacement_data);
-    if (SHCT[signature].calcSaturation() >= insertionThreshold) {
+    if (isUnconfidentPrefetch(pkt, prefetchPriorityThreshold)) {
+        casted_replacement_data->rrpv.saturate();
+    } else if (SHCT[signature].calcSaturation() >= insertionThreshold) {
         casted_replacement_data->rrpv--;
     }
 }
@@ -147,6 +150,13 @@ SHiP::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new SHiPReplData(numRRPVBits));
 }
 
+std::vector<std::shared_ptr<ReplacementData>>
+SHiP::instantiateEntries(std::size_t num_sets, std::size_t assoc)
+{
+    return makeArena<SHiPReplData>(num_sets * assoc,
+                                   SHiPReplData(numRRPVBits));
+}
+
 SHiPMem::SHiPMem(const SHiPMemRPParams &p) : SHiP(p) {}
 
 SHiP::SignatureType
@@ -0,0 +1,506 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Reduction kernels used by replacement policies to select a victim out of
+ * packed per-set arrays of timestamps and counters.
+ *
+ * Every kernel returns the index of the first entry that satisfies the
+ * reduction, which matches the tie-breaking of the scalar "keep the current
+ * victim unless the candidate is strictly better" loops they replace. On
+ * x86-64 the timestamp reductions are always built for AVX2, whatever the
+ * -march of the build, and used when the host supports it; the counter
+ * reductions use SSE2, which every x86-64 host has. Other hosts use the
+ * scalar implementations, which are always available for reference.
+ */
+
+#ifndef __MEM_CACHE_REPLACEMENT_POLICIES_VICTIM_SELECT_HH__
+#define __MEM_CACHE_REPLACEMENT_POLICIES_VICTIM_SELECT_HH__
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include "base/compiler.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+GEM5_DEPRECATED_NAMESPACE(ReplacementPolicy, replacement_policy);
+namespace replacement_policy
+{
+
+/**
+ * Keeps a parameter out of template argument deduction, so that the masks
+ * of the kernels below take the type of the searched values.
+ */
+template <typename T>
+struct NonDeduced
+{
+    typedef T type;
+};
+
+namespace scalar
+{
+
+/**
+ * Find the first entry holding the smallest timestamp.
+ *
+ * @param ticks The timestamps.
+ * @param n Number of timestamps; must be non-zero.
+ * @return Index of the first minimum.
+ */
+inline std::size_t
+findFirstMin(const Tick *ticks, std::size_t n)
+{
+    assert(n > 0);
+    std::size_t victim = 0;
+    for (std::size_t i = 1; i < n; i++) {
+        if (ticks[i] < ticks[victim]) {
+            victim = i;
+        }
+    }
+    return victim;
+}
+
+/**
+ * Find the first entry holding the smallest timestamp among the entries
+ * whose flag does not have any bit of flag_mask set.
+ *
+ * @param ticks The timestamps.
+ * @param flags One flag per timestamp.
+ * @param flag_mask Bits that exclude an entry from the search.
+ * @param n Number of entries.
+ * @return Index of the first eligible minimum, or n if none is eligible.
+ */
+template <typename T>
+inline std::size_t
+findFirstMinIf(const Tick *ticks, const T *flags,
+               typename NonDeduced<T>::type flag_mask, std::size_t n)
+{
+    std::size_t victim = n;
+    for (std::size_t i = 0; i < n; i++) {
+        if (!(flags[i] & flag_mask) &&
+            (victim == n || ticks[i] < ticks[victim])) {
+            victim = i;
+        }
+    }
+    return victim;
+}
+
+/**
+ * Find the first value that does not have any bit of flag_mask set.
+ *
+ * @param values The values to search.
+ * @param flag_mask Bits to look for.
+ * @param n Number of values.
+ * @return Index of the first matching value, or n if there is none.
+ */
+template <typename T>
+inline std::size_t
+findFirstClear(const T *values, typename NonDeduced<T>::type flag_mask,
+               std::size_t n)
+{
+    for (std::size_t i = 0; i < n; i++) {
+        if (!(values[i] & flag_mask)) {
+            return i;
+        }
+    }
+    return n;
+}
+
+/**
+ * Find the first counter holding the largest value, once masked.
+ *
+ * @param counters The counters.
+ * @param value_mask Mask applied to the counters before comparing them.
+ * @param n Number of counters; must be non-zero.
+ * @return Index of the first maximum.
+ */
+template <typename T>
+inline std::size_t
+findFirstMax(const T *counters, typename NonDeduced<T>::type value_mask,
+             std::size_t n)
+{
+    assert(n > 0);
+    std::size_t victim = 0;
+    for (std::size_t i = 1; i < n; i++) {
+        if ((counters[i] & value_mask) > (counters[victim] & value_mask)) {
+            victim = i;
+        }
+    }
+    return victim;
+}
+
+} // namespace scalar
+
+#if defined(__x86_64__)
+
+namespace simd
+{
+
+/**
+ * The timestamp kernels are built for AVX2 whatever the target of the rest
+ * of the simulator, and only called when the host supports it.
+ */
+#define GEM5_VICTIM_SELECT_AVX2 [[gnu::target("avx2")]]
+
+namespace avx2
+{
+
+typedef __m256i TickVec;
+constexpr std::size_t TicksPerVec = 4;
+
+GEM5_VICTIM_SELECT_AVX2 inline TickVec
+tickSet1(uint64_t v)
+{
+    return _mm256_set1_epi64x(v);
+}
+
+GEM5_VICTIM_SELECT_AVX2 inline TickVec
+tickLoad(const Tick *p)
+{
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+}
+
+GEM5_VICTIM_SELECT_AVX2 inline TickVec
+flagLoad(const uint8_t *p)
+{
+    uint32_t bytes;
+    std::memcpy(&bytes, p, sizeof(bytes));
+    return _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(bytes));
+}
+
+GEM5_VICTIM_SELECT_AVX2 inline unsigned
+tickMoveMask(TickVec m)
+{
+    return _mm256_movemask_pd(_mm256_castsi256_pd(m));
+}
+
+/**
+ * Ticks are unsigned, but the vector comparisons are signed: flipping the
+ * sign bit of both operands maps the unsigned order onto the signed one.
+ */
+constexpr uint64_t SignBit = 0x8000000000000000ULL;
+
+/** Horizontal minimum of a vector of biased ticks, returned unbiased. */
+GEM5_VICTIM_SELECT_AVX2 inline Tick
+reduceMin(TickVec biased_min)
+{
+    uint64_t lanes[TicksPerVec];
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), biased_min);
+    Tick min_tick = MaxTick;
+    for (std::size_t lane = 0; lane < TicksPerVec; lane++) {
+        const Tick tick = lanes[lane] ^ SignBit;
+        if (tick < min_tick) {
+            min_tick = tick;
+        }
+    }
+    return min_tick;
+}
+
+GEM5_VICTIM_SELECT_AVX2 inline std::size_t
+findFirstMin(const Tick *ticks, std::size_t n)
+{
+    assert(n > 0);
+    const std::size_t vec_end = n - n % TicksPerVec;
+    if (vec_end == 0) {
+        return scalar::findFirstMin(ticks, n);
+    }
+
+    // First pass: reduce to the smallest timestamp
+    const TickVec bias = tickSet1(SignBit);
+    TickVec vmin = tickSet1(MaxTick ^ SignBit);
+    for (std::size_t i = 0; i < vec_end; i += TicksPerVec) {
+        const TickVec v = _mm256_xor_si256(tickLoad(ticks + i), bias);
+        vmin = _mm256_blendv_epi8(vmin, v, _mm256_cmpgt_epi64(vmin, v));
+    }
+    Tick min_tick = reduceMin(vmin);
+    for (std::size_t i = vec_end; i < n; i++) {
+        if (ticks[i] < min_tick) {
+            min_tick = ticks[i];
+        }
+    }
+
+    // Second pass: locate its first occurrence
+    const TickVec target = tickSet1(min_tick);
+    for (std::size_t i = 0; i < vec_end; i += TicksPerVec) {
+        const unsigned mask = tickMoveMask(
+            _mm256_cmpeq_epi64(tickLoad(ticks + i), target));
+        if (mask) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    std::size_t i = vec_end;
+    while (ticks[i] != min_tick) {
+        i++;
+    }
+    return i;
+}
+
+GEM5_VICTIM_SELECT_AVX2 inline std::size_t
+findFirstMinIf(const Tick *ticks, const uint8_t *flags, uint8_t flag_mask,
+               std::size_t n)
+{
+    const std::size_t vec_end = n - n % TicksPerVec;
+    if (vec_end == 0) {
+        return scalar::findFirstMinIf(ticks, flags, flag_mask, n);
+    }
+
+    // First pass: reduce to the smallest eligible timestamp, remembering
+    // whether any entry was eligible at all
+    const TickVec bias = tickSet1(SignBit);
+    const TickVec vflag_mask = tickSet1(flag_mask);
+    const TickVec zero = tickSet1(0);
+    TickVec vmin = tickSet1(MaxTick ^ SignBit);
+    unsigned any_eligible = 0;
+    for (std::size_t i = 0; i < vec_end; i += TicksPerVec) {
+        const TickVec eligible = _mm256_cmpeq_epi64(
+            _mm256_and_si256(flagLoad(flags + i), vflag_mask), zero);
+        const TickVec v = _mm256_xor_si256(tickLoad(ticks + i), bias);
+        vmin = _mm256_blendv_epi8(vmin, v,
+            _mm256_and_si256(eligible, _mm256_cmpgt_epi64(vmin, v)));
+        any_eligible |= tickMoveMask(eligible);
+    }
+    Tick min_tick = reduceMin(vmin);
+    for (std::size_t i = vec_end; i < n; i++) {
+        if (!(flags[i] & flag_mask)) {
+            any_eligible = 1;
+            if (ticks[i] < min_tick) {
+                min_tick = ticks[i];
+            }
+        }
+    }
+    if (!any_eligible) {
+        return n;
+    }
+
+    // Second pass: locate the first eligible occurrence
+    const TickVec target = tickSet1(min_tick);
+    for (std::size_t i = 0; i < vec_end; i += TicksPerVec) {
+        const TickVec eligible = _mm256_cmpeq_epi64(
+            _mm256_and_si256(flagLoad(flags + i), vflag_mask), zero);
+        const unsigned mask = tickMoveMask(_mm256_and_si256(eligible,
+            _mm256_cmpeq_epi64(tickLoad(ticks + i), target)));
+        if (mask) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    std::size_t i = vec_end;
+    while ((flags[i] & flag_mask) || ticks[i] != min_tick) {
+        i++;
+    }
+    return i;
+}
+
+} // namespace avx2
+
+#undef GEM5_VICTIM_SELECT_AVX2
+
+/**
+ * Whether the host supports AVX2, detected once. Builds that already
+ * target AVX2 skip the detection.
+ */
+inline bool
+hasAvx2()
+{
+#if defined(__AVX2__)
+    return true;
+#else
+    static const bool has_avx2 = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return has_avx2;
+#endif
+}
+
+} // namespace simd
+
+/**
+ * Find the first entry holding the smallest timestamp, with AVX2 when the
+ * host supports it.
+ *
+ * @param ticks The timestamps.
+ * @param n Number of timestamps; must be non-zero.
+ * @return Index of the first minimum.
+ */
+inline std::size_t
+findFirstMin(const Tick *ticks, std::size_t n)
+{
+    if (simd::hasAvx2()) {
+        return simd::avx2::findFirstMin(ticks, n);
+    }
+    return scalar::findFirstMin(ticks, n);
+}
+
+#else
+
+using scalar::findFirstMin;
+
+#endif // __x86_64__
+
+#if defined(__SSE2__)
+
+namespace simd
+{
+
+/** Number of byte counters processed per vector. */
+constexpr std::size_t BytesPerVec = 16;
+
+inline __m128i
+byteLoad(const uint8_t *p)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+}
+
+inline std::size_t
+findFirstClear(const uint8_t *bytes, uint8_t flag_mask, std::size_t n)
+{
+    const __m128i vflag_mask = _mm_set1_epi8(flag_mask);
+    const __m128i zero = _mm_setzero_si128();
+    const std::size_t vec_end = n - n % BytesPerVec;
+    for (std::size_t i = 0; i < vec_end; i += BytesPerVec) {
+        const __m128i clear = _mm_cmpeq_epi8(
+            _mm_and_si128(byteLoad(bytes + i), vflag_mask), zero);
+        const unsigned mask = _mm_movemask_epi8(clear);
+        if (mask) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    const std::size_t tail = scalar::findFirstClear(bytes + vec_end,
+        flag_mask, n - vec_end);
+    return vec_end + tail;
+}
+
+inline std::size_t
+findFirstMax(const uint8_t *counters, uint8_t value_mask, std::size_t n)
+{
+    assert(n > 0);
+    const std::size_t vec_end = n - n % BytesPerVec;
+    if (vec_end == 0) {
+        return scalar::findFirstMax(counters, value_mask, n);
+    }
+
+    // First pass: reduce to the largest masked value
+    const __m128i vvalue_mask = _mm_set1_epi8(value_mask);
+    __m128i vmax = _mm_setzero_si128();
+    for (std::size_t i = 0; i < vec_end; i += BytesPerVec) {
+        vmax = _mm_max_epu8(vmax,
+            _mm_and_si128(byteLoad(counters + i), vvalue_mask));
+    }
+    vmax = _mm_max_epu8(vmax, _mm_srli_si128(vmax, 8));
+    vmax = _mm_max_epu8(vmax, _mm_srli_si128(vmax, 4));
+    vmax = _mm_max_epu8(vmax, _mm_srli_si128(vmax, 2));
+    vmax = _mm_max_epu8(vmax, _mm_srli_si128(vmax, 1));
+    uint8_t max_value = _mm_cvtsi128_si32(vmax) & 0xff;
+    for (std::size_t i = vec_end; i < n; i++) {
+        if ((counters[i] & value_mask) > max_value) {
+            max_value = counters[i] & value_mask;
+        }
+    }
+
+    // Second pass: locate its first occurrence
+    const __m128i target = _mm_set1_epi8(max_value);
+    for (std::size_t i = 0; i < vec_end; i += BytesPerVec) {
+        const unsigned mask = _mm_movemask_epi8(_mm_cmpeq_epi8(
+            _mm_and_si128(byteLoad(counters + i), vvalue_mask), target));
+        if (mask) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    std::size_t i = vec_end;
+    while ((counters[i] & value_mask) != max_value) {
+        i++;
+    }
+    return i;
+}
+
+} // namespace simd
+
+#endif // __SSE2__
+
+/**
+ * @{
+ * The kernels working on flags and counters are vectorized for byte
+ * elements only; wider elements use the scalar implementations.
+ */
+template <typename T>
+inline std::size_t
+findFirstMinIf(const Tick *ticks, const T *flags,
+               typename NonDeduced<T>::type flag_mask, std::size_t n)
+{
+#if defined(__x86_64__)
+    if constexpr (std::is_same_v<T, uint8_t>) {
+        if (simd::hasAvx2()) {
+            return simd::avx2::findFirstMinIf(ticks, flags, flag_mask, n);
+        }
+    }
+#endif
+    return scalar::findFirstMinIf(ticks, flags, flag_mask, n);
+}
+
+template <typename T>
+inline std::size_t
+findFirstClear(const T *values, typename NonDeduced<T>::type flag_mask,
+               std::size_t n)
+{
+#if defined(__SSE2__)
+    if constexpr (std::is_same_v<T, uint8_t>) {
+        return simd::findFirstClear(values, flag_mask, n);
+    }
+#endif
+    return scalar::findFirstClear(values, flag_mask, n);
+}
+
+template <typename T>
+inline std::size_t
+findFirstMax(const T *counters, typename NonDeduced<T>::type value_mask,
+             std::size_t n)
+{
+#if defined(__SSE2__)
+    if constexpr (std::is_same_v<T, uint8_t>) {
+        return simd::findFirstMax(counters, value_mask, n);
+    }
+#endif
+    return scalar::findFirstMax(counters, value_mask, n);
+}
+/** @} */
+
+} // namespace replacement_policy
+} // namespace gem5
+
+#endif // __MEM_CACHE_REPLACEMENT_POLICIES_VICTIM_SELECT_HH__
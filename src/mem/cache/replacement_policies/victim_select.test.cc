@@ -0,0 +1,180 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "mem/cache/replacement_policies/victim_select.hh"
+
+using namespace gem5;
+
+/** Numbers of entries to test, covering vector bodies and scalar tails. */
+static const std::size_t testSizes[] = {1, 2, 3, 4, 5, 7, 8, 15, 16, 17, 32,
+                                        33, 64};
+
+/**
+ * Values are drawn from a tiny range so that ties, which the kernels must
+ * break towards the lowest index, are common. The large offset makes sure
+ * that the top bit of the ticks is exercised too.
+ */
+static Tick
+randomTick(std::mt19937_64 &gen)
+{
+    return (gen() & 0x7) + ((gen() & 1) ? 0x8000000000000000ULL : 0);
+}
+
+TEST(VictimSelectTest, FindFirstMin)
+{
+    std::mt19937_64 gen(1);
+    for (const std::size_t n : testSizes) {
+        for (int iter = 0; iter < 200; iter++) {
+            std::vector<Tick> ticks(n);
+            for (auto &tick : ticks) {
+                tick = randomTick(gen);
+            }
+            ASSERT_EQ(replacement_policy::findFirstMin(ticks.data(), n),
+                replacement_policy::scalar::findFirstMin(ticks.data(), n));
+        }
+    }
+
+    // The maximum tick must be handled as any other value
+    std::vector<Tick> ticks(8, MaxTick);
+    ASSERT_EQ(replacement_policy::findFirstMin(ticks.data(), 8),
+              std::size_t(0));
+    ticks[5] = MaxTick - 1;
+    ASSERT_EQ(replacement_policy::findFirstMin(ticks.data(), 8),
+              std::size_t(5));
+}
+
+TEST(VictimSelectTest, FindFirstMinIf)
+{
+    std::mt19937_64 gen(2);
+    for (const std::size_t n : testSizes) {
+        for (int iter = 0; iter < 200; iter++) {
+            std::vector<Tick> ticks(n);
+            std::vector<uint8_t> flags(n);
+            for (std::size_t i = 0; i < n; i++) {
+                ticks[i] = randomTick(gen);
+                // Make all entries ineligible every once in a while
+                flags[i] = (iter % 8 == 0) ? 0x80 : (gen() & 0x81);
+            }
+            ASSERT_EQ(replacement_policy::findFirstMinIf(ticks.data(),
+                          flags.data(), 0x80, n),
+                      replacement_policy::scalar::findFirstMinIf(
+                          ticks.data(), flags.data(), 0x80, n));
+        }
+    }
+}
+
+TEST(VictimSelectTest, FindFirstClear)
+{
+    std::mt19937_64 gen(3);
+    for (const std::size_t n : testSizes) {
+        for (int iter = 0; iter < 200; iter++) {
+            std::vector<uint8_t> bytes(n);
+            for (auto &byte : bytes) {
+                // Mostly set, so that the first clear byte moves around
+                byte = (gen() & 0x7f) | ((gen() % 8) ? 0x80 : 0);
+            }
+            ASSERT_EQ(replacement_policy::findFirstClear(bytes.data(), 0x80,
+                          n),
+                      replacement_policy::scalar::findFirstClear(
+                          bytes.data(), 0x80, n));
+        }
+    }
+}
+
+TEST(VictimSelectTest, FindFirstMax)
+{
+    std::mt19937_64 gen(4);
+    for (const std::size_t n : testSizes) {
+        for (int iter = 0; iter < 200; iter++) {
+            std::vector<uint8_t> counters(n);
+            for (auto &counter : counters) {
+                counter = gen() & 0xff;
+            }
+            ASSERT_EQ(replacement_policy::findFirstMax(counters.data(), 0x0f,
+                          n),
+                      replacement_policy::scalar::findFirstMax(
+                          counters.data(), 0x0f, n));
+        }
+    }
+}
+
+TEST(VictimSelectTest, WideElements)
+{
+    // Counters and flags wider than a byte use the scalar kernels, which
+    // must honour masks beyond the low byte
+    const uint16_t counters[] = {0x8001, 0x0102, 0x8102, 0x0002};
+    ASSERT_EQ(replacement_policy::findFirstClear(counters, 0x8000, 4),
+              std::size_t(1));
+    ASSERT_EQ(replacement_policy::findFirstMax(counters, 0x7fff, 4),
+              std::size_t(1));
+    ASSERT_EQ(replacement_policy::findFirstMax(counters, 0x00ff, 4),
+              std::size_t(1));
+
+    const uint32_t flags[] = {0x80000000, 0x1, 0x80000000, 0x0};
+    const Tick ticks[] = {1, 5, 2, 5};
+    ASSERT_EQ(replacement_policy::findFirstMinIf(ticks, flags, 0x80000000,
+                  4),
+              std::size_t(1));
+}
+
+#if defined(__x86_64__)
+TEST(VictimSelectTest, Avx2Kernels)
+{
+    // The AVX2 kernels are selected at run time; when the host can execute
+    // them, check them directly whatever the target of the build
+    if (!__builtin_cpu_supports("avx2")) {
+        GTEST_SKIP() << "The host does not support AVX2";
+    }
+    std::mt19937_64 gen(5);
+    for (const std::size_t n : testSizes) {
+        for (int iter = 0; iter < 200; iter++) {
+            std::vector<Tick> ticks(n);
+            std::vector<uint8_t> flags(n);
+            for (std::size_t i = 0; i < n; i++) {
+                ticks[i] = randomTick(gen);
+                flags[i] = (iter % 8 == 0) ? 0x80 : (gen() & 0x81);
+            }
+            ASSERT_EQ(replacement_policy::simd::avx2::findFirstMin(
+                          ticks.data(), n),
+                      replacement_policy::scalar::findFirstMin(
+                          ticks.data(), n));
+            ASSERT_EQ(replacement_policy::simd::avx2::findFirstMinIf(
+                          ticks.data(), flags.data(), 0x80, n),
+                      replacement_policy::scalar::findFirstMinIf(
+                          ticks.data(), flags.data(), 0x80, n));
+        }
+    }
+}
+#endif
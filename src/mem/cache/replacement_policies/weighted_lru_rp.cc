@@ -97,5 +97,11 @@ WeightedLRU::instantiateEntry()
     return std::shared_ptr<ReplacementData>(new WeightedLRUReplData);
 }
 
+std::vector<std::shared_ptr<ReplacementData>>
+WeightedLRU::instantiateEntries(std::size_t num_sets, std::size_t assoc)
+{
+    return makeArena<WeightedLRUReplData>(num_sets * assoc);
+}
+
 } // namespace replacement_policy
 } // namespace gem5
@@ -33,6 +33,7 @@
 #define __MEM_CACHE_REPLACEMENT_POLICIES_WEIGHTED_LRU_RP_HH__
 
 #include <memory>
+#include <vector>
 
 #include "base/types.hh"
 #include "mem/cache/replacement_policies/lru_rp.hh"
@@ -76,6 +77,16 @@ class WeightedLRU : public LRU
      */
     std::shared_ptr<ReplacementData> instantiateEntry() override;
 
+    /**
+     * Instantiate the replacement data of a table in a single arena.
+     *
+     * @param num_sets Number of sets of the table.
+     * @param assoc Associativity of the table.
+     * @return Shared pointers to the replacement data of every entry.
+     */
+    std::vector<std::shared_ptr<ReplacementData>>
+    instantiateEntries(std::size_t num_sets, std::size_t assoc) override;
+
     /**
      * Find replacement victim using weight.
      *
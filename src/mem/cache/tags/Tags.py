@@ -72,6 +72,12 @@ class BaseTags(ClockedObject):
     entry_size = Param.Int(Parent.cache_line_size,
                            "Indexing entry size in bytes")
 
+    # Find blocks through a hash index of the valid blocks instead of
+    # comparing the tags of all the ways of a set. This only speeds up the
+    # simulation of highly associative caches; the timing is unchanged.
+    hashed_lookup = Param.Bool(False,
+        "Whether to find blocks through a hash index of the tags")
+
 class BaseSetAssoc(BaseTags):
     type = 'BaseSetAssoc'
     cxx_header = "mem/cache/tags/base_set_assoc.hh"
@@ -83,18 +89,10 @@ class BaseSetAssoc(BaseTags):
     # Get replacement policy from the parent (cache)
     replacement_policy = Param.BaseReplacementPolicy(
         Parent.replacement_policy, "Replacement policy")
-    
-class SCSetAssoc(BaseTags):
-    type = 'SCSetAssoc'
-    cxx_header = "mem/cache/tags/sc_set_assoc.hh"
-    cxx_class = 'gem5::SCSetAssoc'
-
-    # Get the cache associativity
-    assoc = Param.Int(Parent.assoc, "associativity")
 
-    # Get replacement policy from the parent (cache)
-    replacement_policy = Param.BaseReplacementPolicy(
-        Parent.replacement_policy, "Replacement policy")
+# The Shepherd Cache replacement policy used to require its own tag store.
+# It now works with any of them, so keep the old name for existing configs.
+SCSetAssoc = BaseSetAssoc
 
 class SectorTags(BaseTags):
     type = 'SectorTags'
@@ -140,3 +138,6 @@ class FALRU(BaseTags):
 
     # This tag uses its own embedded indexing
     indexing_policy = NULL
+
+    # This tag already finds its blocks through a hash table
+    hashed_lookup = False
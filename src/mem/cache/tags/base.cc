@@ -62,6 +62,8 @@ BaseTags::BaseTags(const Params &p)
     : ClockedObject(p), blkSize(p.block_size), blkMask(blkSize - 1),
       size(p.size), lookupLatency(p.tag_latency),
       system(p.system), indexingPolicy(p.indexing_policy),
+      tagIndex(p.hashed_lookup ? new TagIndex(p.size / p.block_size) :
+                                 nullptr),
       warmupBound((p.warmup_percentage/100.0) * (p.size / p.block_size)),
       warmedUp(false), numBlocks(p.size / p.block_size),
       dataBlks(new uint8_t[p.size]), // Allocate data storage in one big chunk
@@ -79,12 +81,16 @@ BaseTags::findBlockBySetAndWay(int set, int way) const
 CacheBlk*
 BaseTags::findBlock(Addr addr, bool is_secure) const
 {
+    if (tagIndex) {
+        return tagIndex->find(blkAlign(addr), is_secure);
+    }
+
     // Extract block tag
     Addr tag = extractTag(addr);
 
     // Find possible entries that may contain the given address
-    const std::vector<ReplaceableEntry*> entries =
-        indexingPolicy->getPossibleEntries(addr);
+    const std::vector<ReplaceableEntry*>& entries =
+        indexingPolicy->getPossibleEntries(addr, possibleEntries);
 
     // Search for block
     for (const auto& location : entries) {
@@ -114,6 +120,9 @@ BaseTags::insertBlock(const PacketPtr pkt, CacheBlk *blk)
     // Insert block with tag, src requestor id and task id
     blk->insert(extractTag(pkt->getAddr()), pkt->isSecure(), requestor_id,
                 pkt->req->taskId());
+    if (tagIndex) {
+        tagIndex->insert(blkAlign(pkt->getAddr()), pkt->isSecure(), blk);
+    }
 
     // Check if cache warm up is done
     if (!warmedUp && stats.tagsInUse.value() >= warmupBound) {
@@ -132,6 +141,12 @@ BaseTags::moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk)
     assert(!dest_blk->isValid());
     assert(src_blk->isValid());
 
+    if (tagIndex) {
+        const Addr blk_addr = regenerateBlkAddr(src_blk);
+        tagIndex->erase(blk_addr, src_blk->isSecure());
+        tagIndex->insert(blk_addr, src_blk->isSecure(), dest_blk);
+    }
+
     // Move src's contents to dest's
     *dest_blk = std::move(*src_blk);
 
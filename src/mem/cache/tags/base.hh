@@ -49,13 +49,16 @@
 #include <cassert>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "base/callback.hh"
 #include "base/logging.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "mem/cache/cache_blk.hh"
+#include "mem/cache/tags/tag_index.hh"
 #include "mem/packet.hh"
 #include "params/BaseTags.hh"
 #include "sim/clocked_object.hh"
@@ -88,6 +91,15 @@ class BaseTags : public ClockedObject
     /** Indexing policy */
     BaseIndexingPolicy *indexingPolicy;
 
+    /** Buffer the indexing policy may write the possible entries to. */
+    mutable std::vector<ReplaceableEntry*> possibleEntries;
+
+    /**
+     * Hash index of the valid blocks, used to find blocks without scanning
+     * their sets. Only allocated if hashed lookups are enabled.
+     */
+    std::unique_ptr<TagIndex> tagIndex;
+
     /**
      * The number of tags that need to be touched to meet the warmup
      * percentage.
@@ -260,6 +272,10 @@ class BaseTags : public ClockedObject
         stats.totalRefs += blk->getRefCount();
         stats.sampledRefs++;
 
+        if (tagIndex) {
+            tagIndex->erase(regenerateBlkAddr(blk), blk->isSecure());
+        }
+
         blk->invalidate();
     }
 
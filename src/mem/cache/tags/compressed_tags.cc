@@ -56,6 +56,10 @@ CompressedTags::tagsInit()
     blks = std::vector<CompressionBlk>(numBlocks);
     superBlks = std::vector<SuperBlk>(numSectors);
 
+    // Instantiate the replacement data of every sector at once
+    const auto replacement_data = replacementPolicy->instantiateEntries(
+        numSectors / allocAssoc, allocAssoc);
+
     // Initialize all blocks
     unsigned blk_index = 0;          // index into blks array
     for (unsigned superblock_index = 0; superblock_index < numSectors;
@@ -69,7 +73,7 @@ CompressedTags::tagsInit()
         superblock->setBlkSize(blkSize);
 
         // Associate a replacement data entry to the block
-        superblock->replacementData = replacementPolicy->instantiateEntry();
+        superblock->replacementData = replacement_data[superblock_index];
 
         // Initialize all blocks in this superblock
         superblock->blks.resize(numBlocksPerSector, nullptr);
@@ -107,8 +111,8 @@ CompressedTags::findVictim(Addr addr, const bool is_secure,
                            std::vector<CacheBlk*>& evict_blks)
 {
     // Get all possible locations of this superblock
-    const std::vector<ReplaceableEntry*> superblock_entries =
-        indexingPolicy->getPossibleEntries(addr);
+    const std::vector<ReplaceableEntry*>& superblock_entries =
+        indexingPolicy->getPossibleEntries(addr, possibleEntries);
 
     // Check if the superblock this address belongs to has been allocated. If
     // so, try co-allocating
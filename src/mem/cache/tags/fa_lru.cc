@@ -74,6 +74,8 @@ FALRU::FALRU(const Params &p)
               blkSize);
     if (!isPowerOf2(size))
         fatal("Cache Size must be power of 2 for now");
+    fatal_if(p.hashed_lookup, "FALRU always finds its blocks through its "
+             "own hash table; hashed_lookup must not be set.");
 
     blks = new FALRUBlk[numBlocks];
 }
@@ -143,11 +143,17 @@ class BaseIndexingPolicy : public SimObject
      * Should be called immediately before ReplacementPolicy's findVictim()
      * not to break cache resizing.
      *
+     * This is on the path of every lookup, so it must not allocate: a
+     * policy whose possible entries are already stored contiguously
+     * returns its own storage, and any other policy fills the caller's
+     * buffer, which stops growing once it holds a whole set.
+     *
      * @param addr The addr to a find possible entries for.
-     * @return The possible entries.
+     * @param entries Buffer the possible entries may be written to.
+     * @return The possible entries, valid until the next call.
      */
-    virtual std::vector<ReplaceableEntry*> getPossibleEntries(const Addr addr)
-                                                                    const = 0;
+    virtual const std::vector<ReplaceableEntry*>& getPossibleEntries(
+        const Addr addr, std::vector<ReplaceableEntry*>& entries) const = 0;
 
     /**
      * Regenerate an entry's address from its tag and assigned indexing bits.
@@ -69,8 +69,9 @@ SetAssociative::regenerateAddr(const Addr tag, const ReplaceableEntry* entry)
     return (tag << tagShift) | (entry->getSet() << setShift);
 }
 
-std::vector<ReplaceableEntry*>
-SetAssociative::getPossibleEntries(const Addr addr) const
+const std::vector<ReplaceableEntry*>&
+SetAssociative::getPossibleEntries(const Addr addr,
+    std::vector<ReplaceableEntry*>& entries) const
 {
     return sets[extractSet(addr)];
 }
@@ -206,15 +206,17 @@ SkewedAssociative::regenerateAddr(const Addr tag,
            ((deskew(addr_set, entry->getWay()) & setMask) << setShift);
 }
 
-std::vector<ReplaceableEntry*>
-SkewedAssociative::getPossibleEntries(const Addr addr) const
+const std::vector<ReplaceableEntry*>&
+SkewedAssociative::getPossibleEntries(const Addr addr,
+    std::vector<ReplaceableEntry*>& entries) const
 {
-    std::vector<ReplaceableEntry*> entries;
+    // Only grows the buffer the first time it is used
+    entries.resize(assoc);
 
     // Parse all ways
     for (uint32_t way = 0; way < assoc; ++way) {
         // Apply hash to get set, and get way entry in it
-        entries.push_back(sets[extractSet(addr, way)][way]);
+        entries[way] = sets[extractSet(addr, way)][way];
     }
 
     return entries;
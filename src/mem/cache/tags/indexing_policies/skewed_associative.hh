@@ -156,12 +156,15 @@ class SkewedAssociative : public BaseIndexingPolicy
      * Find all possible entries for insertion and replacement of an address.
      * Should be called immediately before ReplacementPolicy's findVictim()
      * not to break cache resizing.
+     * Each way comes from a different set, so the entries are gathered
+     * into the buffer.
      *
      * @param addr The addr to a find possible entries for.
-     * @return The possible entries.
+     * @param entries Buffer the possible entries are written to.
+     * @return The possible entries, i.e., the buffer.
      */
-    std::vector<ReplaceableEntry*> getPossibleEntries(const Addr addr) const
-                                                                   override;
+    const std::vector<ReplaceableEntry*>& getPossibleEntries(const Addr addr,
+        std::vector<ReplaceableEntry*>& entries) const override;
 
     /**
      * Regenerate an entry's address from its tag and assigned set and way.
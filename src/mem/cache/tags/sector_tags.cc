@@ -74,6 +74,10 @@ SectorTags::tagsInit()
     blks = std::vector<SectorSubBlk>(numBlocks);
     secBlks = std::vector<SectorBlk>(numSectors);
 
+    // Instantiate the replacement data of every sector at once
+    const auto replacement_data = replacementPolicy->instantiateEntries(
+        numSectors / allocAssoc, allocAssoc);
+
     // Initialize all blocks
     unsigned blk_index = 0;       // index into blks array
     for (unsigned sec_blk_index = 0; sec_blk_index < numSectors;
@@ -83,7 +87,7 @@ SectorTags::tagsInit()
         SectorBlk* sec_blk = &secBlks[sec_blk_index];
 
         // Associate a replacement data entry to the sector
-        sec_blk->replacementData = replacementPolicy->instantiateEntry();
+        sec_blk->replacementData = replacement_data[sec_blk_index];
 
         // Initialize all blocks in this sector
         sec_blk->blks.resize(numBlocksPerSector);
@@ -249,6 +253,10 @@ SectorTags::moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk)
 CacheBlk*
 SectorTags::findBlock(Addr addr, bool is_secure) const
 {
+    if (tagIndex) {
+        return tagIndex->find(blkAlign(addr), is_secure);
+    }
+
     // Extract sector tag
     const Addr tag = extractTag(addr);
 
@@ -257,8 +265,8 @@ SectorTags::findBlock(Addr addr, bool is_secure) const
     const Addr offset = extractSectorOffset(addr);
 
     // Find all possible sector entries that may contain the given address
-    const std::vector<ReplaceableEntry*> entries =
-        indexingPolicy->getPossibleEntries(addr);
+    const std::vector<ReplaceableEntry*>& entries =
+        indexingPolicy->getPossibleEntries(addr, possibleEntries);
 
     // Search for block
     for (const auto& sector : entries) {
@@ -277,8 +285,8 @@ SectorTags::findVictim(Addr addr, const bool is_secure, const std::size_t size,
                        std::vector<CacheBlk*>& evict_blks)
 {
     // Get possible entries to be victimized
-    const std::vector<ReplaceableEntry*> sector_entries =
-        indexingPolicy->getPossibleEntries(addr);
+    const std::vector<ReplaceableEntry*>& sector_entries =
+        indexingPolicy->getPossibleEntries(addr, possibleEntries);
 
     // Check if the sector this address belongs to has been allocated
     Addr tag = extractTag(addr);
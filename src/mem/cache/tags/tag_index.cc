@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Definitions of a hash index of the valid blocks of a tag store.
+ */
+
+#include "mem/cache/tags/tag_index.hh"
+
+#include <algorithm>
+#include <cassert>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+TagIndex::TagIndex(std::size_t max_entries)
+  : slots(std::size_t(1) <<
+              ceilLog2(2 * std::max<std::size_t>(1, max_entries)),
+          Slot{0, nullptr}),
+    slotMask(slots.size() - 1),
+    hashShift(64 - floorLog2(slots.size())), numEntries(0)
+{
+}
+
+std::size_t
+TagIndex::findSlot(Addr key) const
+{
+    // The table is never full, so the search always ends
+    std::size_t slot = homeSlot(key);
+    while (slots[slot].blk && slots[slot].key != key) {
+        slot = (slot + 1) & slotMask;
+    }
+    return slot;
+}
+
+void
+TagIndex::insert(Addr blk_addr, bool is_secure, CacheBlk *blk)
+{
+    assert(blk);
+    panic_if(2 * (numEntries + 1) > slots.size(),
+             "Indexing more blocks than the tag store can hold.");
+
+    const Addr key = makeKey(blk_addr, is_secure);
+    Slot &slot = slots[findSlot(key)];
+    panic_if(slot.blk, "Address %#x is already indexed.", blk_addr);
+    slot.key = key;
+    slot.blk = blk;
+    numEntries++;
+}
+
+void
+TagIndex::erase(Addr blk_addr, bool is_secure)
+{
+    std::size_t hole = findSlot(makeKey(blk_addr, is_secure));
+    panic_if(!slots[hole].blk, "Address %#x is not indexed.", blk_addr);
+    numEntries--;
+
+    // Move back the entries that follow in the cluster and would not be
+    // found anymore through the hole. An entry can fill the hole when the
+    // hole lies between its home slot and the slot it is in.
+    std::size_t slot = hole;
+    while (true) {
+        slot = (slot + 1) & slotMask;
+        if (!slots[slot].blk) {
+            break;
+        }
+        const std::size_t home = homeSlot(slots[slot].key);
+        if (((slot - home) & slotMask) >= ((slot - hole) & slotMask)) {
+            slots[hole] = slots[slot];
+            hole = slot;
+        }
+    }
+    slots[hole].blk = nullptr;
+}
+
+} // namespace gem5
@@ -0,0 +1,151 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of a hash index of the valid blocks of a tag store.
+ */
+
+#ifndef __MEM_CACHE_TAGS_TAG_INDEX_HH__
+#define __MEM_CACHE_TAGS_TAG_INDEX_HH__
+
+#include <cstddef>
+#include <vector>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+class CacheBlk;
+
+/**
+ * An open addressing hash table that maps the address and security bit
+ * of every valid block of a tag store to the block holding it. It allows
+ * finding a block without comparing the tags of every way of a set, which
+ * is costly for highly associative caches.
+ *
+ * The table uses linear probing, and entries are removed by shifting the
+ * following entries of their cluster back, so that no tombstones are
+ * left behind and lookups never degrade. The table holds at least twice
+ * as many slots as the number of blocks it may index, so it is never
+ * more than half full.
+ *
+ * The index does not model any hardware structure; it is only a faster
+ * way to simulate the tag comparisons.
+ */
+class TagIndex
+{
+  private:
+    /** A slot of the table. It is empty when it has no block. */
+    struct Slot
+    {
+        Addr key;
+        CacheBlk *blk;
+    };
+
+    /** The slots of the table. Its size is a power of 2. */
+    std::vector<Slot> slots;
+
+    /** Mask applied to slot numbers to wrap around the table. */
+    const std::size_t slotMask;
+
+    /** Right shift applied to the hashed keys to get their home slot. */
+    const unsigned hashShift;
+
+    /** Number of blocks in the table. */
+    std::size_t numEntries;
+
+    /**
+     * Merge a block address and its security bit. The low bits of block
+     * addresses are always zero, so they have room for the security bit.
+     */
+    static Addr
+    makeKey(Addr blk_addr, bool is_secure)
+    {
+        return blk_addr | Addr(is_secure);
+    }
+
+    /** Get the slot a key is placed at when there are no collisions. */
+    std::size_t
+    homeSlot(Addr key) const
+    {
+        // Fibonacci hashing spreads the consecutive block addresses of
+        // streams over the whole table
+        return (key * 0x9e3779b97f4a7c15ULL) >> hashShift;
+    }
+
+    /**
+     * Get the slot holding a key, or the empty slot that ends its probe
+     * sequence if the key is not in the table.
+     */
+    std::size_t findSlot(Addr key) const;
+
+  public:
+    /**
+     * @param max_entries The maximum number of blocks indexed at once.
+     */
+    TagIndex(std::size_t max_entries);
+
+    /**
+     * Find the block holding an address.
+     *
+     * @param blk_addr The block aligned address to look for.
+     * @param is_secure True if the target memory space is secure.
+     * @return The block, or nullptr if it is not in the index.
+     */
+    CacheBlk*
+    find(Addr blk_addr, bool is_secure) const
+    {
+        return slots[findSlot(makeKey(blk_addr, is_secure))].blk;
+    }
+
+    /**
+     * Add a block that has just become valid to the index.
+     *
+     * @param blk_addr The block aligned address of the block.
+     * @param is_secure True if the block is in the secure memory space.
+     * @param blk The block. Its address must not be in the index yet.
+     */
+    void insert(Addr blk_addr, bool is_secure, CacheBlk *blk);
+
+    /**
+     * Remove a block from the index.
+     *
+     * @param blk_addr The block aligned address of the block.
+     * @param is_secure True if the block is in the secure memory space.
+     */
+    void erase(Addr blk_addr, bool is_secure);
+
+    /** Get the number of blocks in the index. */
+    std::size_t size() const { return numEntries; }
+};
+
+} // namespace gem5
+
+#endif //__MEM_CACHE_TAGS_TAG_INDEX_HH__
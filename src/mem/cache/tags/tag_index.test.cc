@@ -0,0 +1,134 @@
+/**
+ * Copyright (c) 2026 The gem5 Shepherd Cache authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "mem/cache/tags/tag_index.hh"
+
+using namespace gem5;
+
+/**
+ * The index never dereferences the blocks, so any distinct pointers can
+ * stand for them.
+ */
+static CacheBlk*
+fakeBlock(std::vector<uint8_t> &storage, std::size_t i)
+{
+    return reinterpret_cast<CacheBlk*>(&storage[i]);
+}
+
+/** An empty index does not find anything. */
+TEST(TagIndexTest, Empty)
+{
+    TagIndex index(0);
+    ASSERT_EQ(index.size(), 0);
+    ASSERT_EQ(index.find(0x0, false), nullptr);
+    ASSERT_EQ(index.find(0x40, true), nullptr);
+}
+
+/** The security bit is part of the key. */
+TEST(TagIndexTest, SecureBit)
+{
+    std::vector<uint8_t> storage(2);
+    TagIndex index(2);
+    index.insert(0x40, false, fakeBlock(storage, 0));
+    ASSERT_EQ(index.find(0x40, false), fakeBlock(storage, 0));
+    ASSERT_EQ(index.find(0x40, true), nullptr);
+
+    index.insert(0x40, true, fakeBlock(storage, 1));
+    ASSERT_EQ(index.find(0x40, false), fakeBlock(storage, 0));
+    ASSERT_EQ(index.find(0x40, true), fakeBlock(storage, 1));
+    ASSERT_EQ(index.size(), 2);
+
+    index.erase(0x40, false);
+    ASSERT_EQ(index.find(0x40, false), nullptr);
+    ASSERT_EQ(index.find(0x40, true), fakeBlock(storage, 1));
+    ASSERT_EQ(index.size(), 1);
+}
+
+/** Inserting more blocks than announced is an error. */
+TEST(TagIndexTest, Overflow)
+{
+    std::vector<uint8_t> storage(3);
+    TagIndex index(2);
+    index.insert(0x0, false, fakeBlock(storage, 0));
+    index.insert(0x40, false, fakeBlock(storage, 1));
+    ASSERT_ANY_THROW(index.insert(0x80, false, fakeBlock(storage, 2)));
+}
+
+/**
+ * Mix random insertions and removals on a full index, and compare it to
+ * a reference map. The addresses come from a small pool, which creates
+ * long collision clusters that removals must keep reachable.
+ */
+TEST(TagIndexTest, RandomAgainstMap)
+{
+    const std::size_t max_entries = 64;
+    const std::size_t num_addrs = 256;
+    std::vector<uint8_t> storage(max_entries);
+    std::vector<CacheBlk*> free_blks;
+    for (std::size_t i = 0; i < max_entries; i++) {
+        free_blks.push_back(fakeBlock(storage, i));
+    }
+
+    TagIndex index(max_entries);
+    std::map<std::pair<Addr, bool>, CacheBlk*> reference;
+    std::mt19937 gen(12);
+    for (int iter = 0; iter < 20000; iter++) {
+        const Addr addr = (gen() % num_addrs) * 64;
+        const bool is_secure = gen() & 1;
+        const auto key = std::make_pair(addr, is_secure);
+        const auto it = reference.find(key);
+        if (it != reference.end()) {
+            index.erase(addr, is_secure);
+            free_blks.push_back(it->second);
+            reference.erase(it);
+        } else if (!free_blks.empty()) {
+            CacheBlk *blk = free_blks.back();
+            free_blks.pop_back();
+            index.insert(addr, is_secure, blk);
+            reference[key] = blk;
+        }
+
+        ASSERT_EQ(index.size(), reference.size());
+        for (Addr a = 0; a < num_addrs * 64; a += 64) {
+            for (const bool s : {false, true}) {
+                const auto ref = reference.find(std::make_pair(a, s));
+                ASSERT_EQ(index.find(a, s),
+                          ref == reference.end() ? nullptr : ref->second);
+            }
+        }
+    }
+}
@@ -46,7 +46,7 @@ namespace gem5
 class TaggedEntry : public ReplaceableEntry
 {
   public:
-    TaggedEntry() : _valid(false), _secure(false), _tag(MaxAddr) {}
+    TaggedEntry() : _tag(MaxAddr), _valid(false), _secure(false) {}
     ~TaggedEntry() = default;
 
     /**
@@ -134,8 +134,13 @@ class TaggedEntry : public ReplaceableEntry
     }
 
   private:
+    /** The entry's tag. */
+    Addr _tag;
+
     /**
      * Valid bit. The contents of this entry are only valid if this bit is set.
+     * The flags are declared after the tag so that the tail padding they
+     * leave can hold the small fields of derived classes.
      * @sa invalidate()
      * @sa insert()
      */
@@ -147,9 +152,6 @@ class TaggedEntry : public ReplaceableEntry
      */
     bool _secure;
 
-    /** The entry's tag. */
-    Addr _tag;
-
     /** Clear secure bit. Should be only used by the invalidation function. */
     void clearSecure() { _secure = false; }
 };
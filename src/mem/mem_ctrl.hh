@@ -767,6 +767,18 @@ class MemCtrl : public qos::MemCtrl
      */
     bool inWriteBusState(bool next_state) const;
 
+    /**
+     * Get the occupancy of the read queues, so that requestors can tell
+     * how close the controller is to being saturated
+     *
+     * @return Fraction of the read buffer entries in use
+     */
+    double
+    readQueueOccupancy() const
+    {
+        return double(totalReadQueueSize) / readBufferSize;
+    }
+
     Port &getPort(const std::string &if_name,
                   PortID idx=InvalidPortID) override;
 
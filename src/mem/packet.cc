@@ -62,6 +62,9 @@
 namespace gem5
 {
 
+FreeListPool Packet::pool("packet", sizeof(Packet));
+FreeListPool Packet::dataPool("packetData", Packet::PooledDataSize);
+
 const MemCmd::CommandInfo
 MemCmd::commandInfo[] =
 {
@@ -56,6 +56,7 @@
 #include "base/cast.hh"
 #include "base/compiler.hh"
 #include "base/flags.hh"
+#include "base/free_list_pool.hh"
 #include "base/logging.hh"
 #include "base/printable.hh"
 #include "base/types.hh"
@@ -350,6 +351,9 @@ class Packet : public Printable
         /// the packet is destroyed. The pointer is assumed to be pointing
         /// to an array, and delete [] is consequently called
         DYNAMIC_DATA           = 0x00002000,
+        /// The dynamic data was taken from the packet data pool, and must
+        /// be given back to it rather than deleted
+        POOLED_DATA            = 0x00004000,
 
         /// suppress the error if this packet encounters a functional
         /// access failure.
@@ -374,6 +378,18 @@ class Packet : public Printable
     RequestPtr req;
 
   private:
+    /** Pool the packets are allocated from. */
+    static FreeListPool pool;
+
+    /**
+     * Pool the data of packets of up to PooledDataSize bytes, i.e. most
+     * cache line sized transfers, is allocated from.
+     */
+    static FreeListPool dataPool;
+
+    /** Largest data size that is allocated from the data pool. */
+    static constexpr unsigned PooledDataSize = 64;
+
    /**
     * A pointer to the data being transferred. It can be different
     * sizes at each level of the hierarchy so it belongs to the
@@ -1036,6 +1052,27 @@ class Packet : public Printable
         deleteData();
     }
 
+    /**
+     * Packets are created and destroyed for almost every memory access,
+     * so they are taken from a pool instead of the heap.
+     */
+    static void *
+    operator new(std::size_t size)
+    {
+        return size == sizeof(Packet) ? pool.allocate() :
+                                        ::operator new(size);
+    }
+
+    static void
+    operator delete(void *p, std::size_t size)
+    {
+        if (size == sizeof(Packet)) {
+            pool.deallocate(p);
+        } else {
+            ::operator delete(p);
+        }
+    }
+
     /**
      * Take a request packet and modify it in place to be suitable for
      * returning as a response to that request.
@@ -1327,10 +1364,12 @@ class Packet : public Printable
     void
     deleteData()
     {
-        if (flags.isSet(DYNAMIC_DATA))
+        if (flags.isSet(POOLED_DATA))
+            dataPool.deallocate(data);
+        else if (flags.isSet(DYNAMIC_DATA))
             delete [] data;
 
-        flags.clear(STATIC_DATA|DYNAMIC_DATA);
+        flags.clear(STATIC_DATA|DYNAMIC_DATA|POOLED_DATA);
         data = NULL;
     }
 
@@ -1343,7 +1382,12 @@ class Packet : public Printable
         if (hasData() || hasRespData()) {
             assert(flags.noneSet(STATIC_DATA|DYNAMIC_DATA));
             flags.set(DYNAMIC_DATA);
-            data = new uint8_t[getSize()];
+            if (getSize() <= PooledDataSize) {
+                flags.set(POOLED_DATA);
+                data = static_cast<PacketDataPtr>(dataPool.allocate());
+            } else {
+                data = new uint8_t[getSize()];
+            }
         }
     }
 
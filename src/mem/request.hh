@@ -370,6 +370,8 @@ class Request
         VALID_HTM_ABORT_CAUSE = 0x00000400,
         /** Whether or not the instruction count is valid. */
         VALID_INST_COUNT      = 0x00000800,
+        /** Whether or not the prefetch priority is valid. */
+        VALID_PREFETCH_PRIORITY = 0x00001000,
         /**
          * These flags are *not* cleared when a Request object is reused
          * (assigned a new address).
@@ -456,6 +458,12 @@ class Request
     /** program counter of initiating access; for tracing/debugging */
     Addr _pc = MaxAddr;
 
+    /**
+     * Priority given to a hardware prefetch by the prefetcher that
+     * generated it, which caches can use as a hint of its usefulness.
+     */
+    int32_t _prefetchPriority = 0;
+
     /** Sequence number of the instruction that creates the request */
     InstSeqNum _reqInstSeqNum = 0;
 
@@ -511,7 +519,8 @@ class Request
           _time(other._time),
           _taskId(other._taskId), _vaddr(other._vaddr),
           _extraData(other._extraData), _contextId(other._contextId),
-          _pc(other._pc), _reqInstSeqNum(other._reqInstSeqNum),
+          _pc(other._pc), _prefetchPriority(other._prefetchPriority),
+          _reqInstSeqNum(other._reqInstSeqNum),
           _localAccessor(other._localAccessor),
           translateDelta(other.translateDelta),
           accessDelta(other.accessDelta), depth(other.depth)
@@ -956,6 +965,38 @@ class Request
         return _pc;
     }
 
+    void
+    setPrefetchPriority(int32_t priority)
+    {
+        privateFlags.set(VALID_PREFETCH_PRIORITY);
+        _prefetchPriority = priority;
+    }
+
+    /**
+     * Drop the priority of a hardware prefetch, e.g. when a demand
+     * needs its block, so that the block is not filled as a prefetch.
+     */
+    void
+    clearPrefetchPriority()
+    {
+        privateFlags.clear(VALID_PREFETCH_PRIORITY);
+        _prefetchPriority = 0;
+    }
+
+    bool
+    hasPrefetchPriority() const
+    {
+        return privateFlags.isSet(VALID_PREFETCH_PRIORITY);
+    }
+
+    /** Accessor function for the priority of hardware prefetches. */
+    int32_t
+    getPrefetchPriority() const
+    {
+        assert(hasPrefetchPriority());
+        return _prefetchPriority;
+    }
+
     /**
      * Increment/Get the depth at which this request is responded to.
      * This currently happens when the request misses in any cache level.
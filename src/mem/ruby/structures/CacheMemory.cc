@@ -102,10 +102,11 @@ CacheMemory::init()
     replacement_data.resize(m_cache_num_sets,
                                std::vector<ReplData>(m_cache_assoc, nullptr));
     // instantiate all the replacement_data here
+    const auto entries = m_replacementPolicy_ptr->instantiateEntries(
+        m_cache_num_sets, m_cache_assoc);
     for (int i = 0; i < m_cache_num_sets; i++) {
         for ( int j = 0; j < m_cache_assoc; j++) {
-            replacement_data[i][j] =
-                                m_replacementPolicy_ptr->instantiateEntry();
+            replacement_data[i][j] = entries[i * m_cache_assoc + j];
         }
     }
 }
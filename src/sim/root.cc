@@ -75,6 +75,15 @@ Root::RootStats::RootStats()
              "The number of ticks simulated per host second (ticks/s)"),
     ADD_STAT(hostMemory, statistics::units::Byte::get(),
              "Number of bytes of host memory used"),
+    ADD_STAT(hostPoolHits, statistics::units::Count::get(),
+             "Number of host allocations served by the free list of each "
+             "memory pool"),
+    ADD_STAT(hostPoolMisses, statistics::units::Count::get(),
+             "Number of host allocations each memory pool took from the "
+             "heap"),
+    ADD_STAT(hostPoolHitRate, statistics::units::Ratio::get(),
+             "Fraction of the host allocations of each memory pool served "
+             "by its free list"),
 
     statTime(true),
     startTick(0)
@@ -103,15 +112,50 @@ Root::RootStats::RootStats()
     hostTickRate = simTicks / hostSeconds;
 }
 
+void
+Root::RootStats::regStats()
+{
+    statistics::Group::regStats();
+
+    // All the pools have static storage, so they exist by now
+    const auto &pools = FreeListPool::pools();
+    hostPoolHits.init(pools.size());
+    hostPoolMisses.init(pools.size());
+    for (std::size_t i = 0; i < pools.size(); i++) {
+        hostPoolHits.subname(i, pools[i]->name());
+        hostPoolMisses.subname(i, pools[i]->name());
+    }
+    hostPoolHitRate = hostPoolHits / (hostPoolHits + hostPoolMisses);
+    poolCountsAtReset.resize(pools.size());
+}
+
 void
 Root::RootStats::resetStats()
 {
     statTime.setTimer();
     startTick = curTick();
 
+    const auto &pools = FreeListPool::pools();
+    for (std::size_t i = 0; i < poolCountsAtReset.size(); i++) {
+        poolCountsAtReset[i] = pools[i]->counts();
+    }
+
     statistics::Group::resetStats();
 }
 
+void
+Root::RootStats::preDumpStats()
+{
+    statistics::Group::preDumpStats();
+
+    const auto &pools = FreeListPool::pools();
+    for (std::size_t i = 0; i < poolCountsAtReset.size(); i++) {
+        const FreeListPool::Counts counts = pools[i]->counts();
+        hostPoolHits[i] = counts.hits - poolCountsAtReset[i].hits;
+        hostPoolMisses[i] = counts.misses - poolCountsAtReset[i].misses;
+    }
+}
+
 /*
  * This function is called periodically by an event in M5 and ensures that
  * at least as much real time has passed between invocations as simulated time.
@@ -51,6 +51,7 @@
 #ifndef __SIM_ROOT_HH__
 #define __SIM_ROOT_HH__
 
+#include "base/free_list_pool.hh"
 #include "base/statistics.hh"
 #include "base/time.hh"
 #include "base/types.hh"
@@ -99,7 +100,9 @@ class Root : public SimObject
   public: // Global statistics
     struct RootStats : public statistics::Group
     {
+        void regStats() override;
         void resetStats() override;
+        void preDumpStats() override;
 
         statistics::Formula simSeconds;
         statistics::Value simTicks;
@@ -110,6 +113,12 @@ class Root : public SimObject
         statistics::Formula hostTickRate;
         statistics::Value hostMemory;
 
+        /** Allocations served by the free list of each memory pool. */
+        statistics::Vector hostPoolHits;
+        /** Allocations each memory pool had to ask the heap for. */
+        statistics::Vector hostPoolMisses;
+        statistics::Formula hostPoolHitRate;
+
         static RootStats instance;
 
       private:
@@ -120,6 +129,9 @@ class Root : public SimObject
 
         Time statTime;
         Tick startTick;
+
+        /** Usage of the memory pools at the last stats reset. */
+        std::vector<FreeListPool::Counts> poolCountsAtReset;
     };
 
   public: